@@ -0,0 +1,248 @@
+#pragma once
+
+/**
+ * @file bench.hpp
+ * @brief Minimal micro-benchmark harness
+ *
+ * Each benchmark body runs in batches sized so one batch takes about
+ * kTargetBatchNs. After warm-up batches, the timed repetitions are reduced
+ * to a median and p99 per operation. On x86 the TSC is sampled alongside
+ * the wall clock to report cycles/op.
+ *
+ * Results can be written as JSON (one benchmark per line) and compared
+ * against a stored baseline. Any benchmark whose median is slower than
+ * the baseline by more than the threshold counts as a regression.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define BENCH_HAVE_TSC 1
+#endif
+
+namespace bench {
+
+/**
+ * @brief Keep a value (and the work that produced it) from being optimised away
+ */
+template<typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+struct Result {
+    std::string name;
+    uint64_t ops = 0;          // Operations per repetition
+    double median_ns = 0.0;    // Per operation
+    double p99_ns = 0.0;       // Per operation
+    double min_ns = 0.0;       // Per operation
+    double cycles_per_op = 0.0; // 0 when no cycle counter is available
+};
+
+struct Options {
+    int warmup = 3;
+    int repetitions = 31;
+    const char* filter = nullptr;    // Substring match on benchmark name
+    const char* json_path = nullptr;
+    const char* baseline_path = nullptr;
+    double threshold_percent = 10.0;
+};
+
+class Runner {
+public:
+    static constexpr double kTargetBatchNs = 2e6;
+
+    /**
+     * @brief Register a benchmark
+     * @param name Unique name, also the key in baseline files
+     * @param body Runs @p ops operations; ops is chosen by the harness
+     */
+    void add(const char* name, std::function<void(uint64_t ops)> body) {
+        benchmarks_.push_back({name, std::move(body)});
+    }
+
+    /**
+     * @brief Parse --filter, --reps, --warmup, --json, --compare, --threshold
+     * @return false on an unknown argument
+     */
+    static bool parseArgs(int argc, char** argv, Options& options) {
+        for (int i = 1; i < argc; i++) {
+            const char* arg = argv[i];
+            const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+            if (value == nullptr) return false;
+            if (strcmp(arg, "--filter") == 0) options.filter = value;
+            else if (strcmp(arg, "--reps") == 0) options.repetitions = std::max(1, atoi(value));
+            else if (strcmp(arg, "--warmup") == 0) options.warmup = atoi(value);
+            else if (strcmp(arg, "--json") == 0) options.json_path = value;
+            else if (strcmp(arg, "--compare") == 0) options.baseline_path = value;
+            else if (strcmp(arg, "--threshold") == 0) options.threshold_percent = atof(value);
+            else return false;
+            i++;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Run all matching benchmarks, print a table, write/compare JSON
+     * @return Process exit code: 0, or 1 on regression or I/O failure
+     */
+    int run(const Options& options) {
+        std::vector<Result> results;
+        printf("%-28s %12s %10s %10s %10s %10s\n",
+               "benchmark", "ops/rep", "median ns", "p99 ns", "min ns", "cycles/op");
+        for (const Benchmark& b : benchmarks_) {
+            if (options.filter && strstr(b.name, options.filter) == nullptr) continue;
+            Result r = measure(b, options);
+            printf("%-28s %12llu %10.2f %10.2f %10.2f %10.1f\n", r.name.c_str(),
+                   static_cast<unsigned long long>(r.ops),
+                   r.median_ns, r.p99_ns, r.min_ns, r.cycles_per_op);
+            results.push_back(r);
+        }
+
+        int status = 0;
+        if (options.json_path && !writeJson(options.json_path, results)) {
+            fprintf(stderr, "cannot write %s\n", options.json_path);
+            status = 1;
+        }
+        if (options.baseline_path) {
+            std::vector<Result> baseline;
+            if (!readJson(options.baseline_path, baseline)) {
+                fprintf(stderr, "cannot read %s\n", options.baseline_path);
+                return 1;
+            }
+            if (compare(results, baseline, options.threshold_percent) > 0) status = 1;
+        }
+        return status;
+    }
+
+    static bool writeJson(const char* path, const std::vector<Result>& results) {
+        FILE* out = fopen(path, "w");
+        if (out == nullptr) return false;
+        fprintf(out, "{\"benchmarks\":[\n");
+        for (size_t i = 0; i < results.size(); i++) {
+            const Result& r = results[i];
+            fprintf(out, "{\"name\":\"%s\",\"ops\":%llu,\"median_ns\":%.3f,\"p99_ns\":%.3f,"
+                         "\"min_ns\":%.3f,\"cycles_per_op\":%.2f}%s\n",
+                    r.name.c_str(), static_cast<unsigned long long>(r.ops), r.median_ns,
+                    r.p99_ns, r.min_ns, r.cycles_per_op, i + 1 < results.size() ? "," : "");
+        }
+        fprintf(out, "]}\n");
+        return fclose(out) == 0;
+    }
+
+    /**
+     * @brief Read a file produced by writeJson (one benchmark object per line)
+     */
+    static bool readJson(const char* path, std::vector<Result>& results) {
+        FILE* in = fopen(path, "r");
+        if (in == nullptr) return false;
+        char line[512];
+        while (fgets(line, sizeof(line), in)) {
+            char name[128];
+            Result r;
+            unsigned long long ops = 0;
+            if (sscanf(line, "{\"name\":\"%127[^\"]\",\"ops\":%llu,\"median_ns\":%lf,\"p99_ns\":%lf,"
+                             "\"min_ns\":%lf,\"cycles_per_op\":%lf",
+                       name, &ops, &r.median_ns, &r.p99_ns, &r.min_ns, &r.cycles_per_op) == 6) {
+                r.name = name;
+                r.ops = ops;
+                results.push_back(r);
+            }
+        }
+        fclose(in);
+        return true;
+    }
+
+    /**
+     * @brief Print median deltas against a baseline
+     * @return Number of regressions beyond @p threshold_percent
+     */
+    static int compare(const std::vector<Result>& current, const std::vector<Result>& baseline,
+                       double threshold_percent) {
+        int regressions = 0;
+        printf("\n%-28s %10s %10s %8s\n", "benchmark", "base ns", "now ns", "delta");
+        for (const Result& r : current) {
+            auto it = std::find_if(baseline.begin(), baseline.end(),
+                                   [&r](const Result& b) { return b.name == r.name; });
+            if (it == baseline.end()) {
+                printf("%-28s %10s %10.2f %8s\n", r.name.c_str(), "-", r.median_ns, "new");
+                continue;
+            }
+            double delta = (r.median_ns - it->median_ns) / it->median_ns * 100.0;
+            bool regressed = delta > threshold_percent;
+            regressions += regressed;
+            printf("%-28s %10.2f %10.2f %+7.1f%%%s\n", r.name.c_str(), it->median_ns,
+                   r.median_ns, delta, regressed ? "  REGRESSION" : "");
+        }
+        printf("%d regression(s) above %.1f%%\n", regressions, threshold_percent);
+        return regressions;
+    }
+
+private:
+    struct Benchmark {
+        const char* name;
+        std::function<void(uint64_t)> body;
+    };
+
+    static uint64_t cycles() {
+#ifdef BENCH_HAVE_TSC
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+    static double elapsedNs(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    static Result measure(const Benchmark& b, const Options& options) {
+        // Grow the batch until it is long enough to time reliably
+        uint64_t ops = 1;
+        for (;;) {
+            auto start = std::chrono::steady_clock::now();
+            b.body(ops);
+            double ns = elapsedNs(start);
+            if (ns >= kTargetBatchNs || ops >= (1ull << 30)) break;
+            ops = ns < kTargetBatchNs / 100 ? ops * 10 : static_cast<uint64_t>(ops * kTargetBatchNs / ns) + 1;
+        }
+
+        for (int i = 0; i < options.warmup; i++) b.body(ops);
+
+        std::vector<double> per_op(options.repetitions);
+        std::vector<double> cycles_per_op(options.repetitions);
+        for (int i = 0; i < options.repetitions; i++) {
+            uint64_t c0 = cycles();
+            auto start = std::chrono::steady_clock::now();
+            b.body(ops);
+            double ns = elapsedNs(start);
+            uint64_t c1 = cycles();
+            per_op[i] = ns / ops;
+            cycles_per_op[i] = static_cast<double>(c1 - c0) / ops;
+        }
+        std::sort(per_op.begin(), per_op.end());
+        std::sort(cycles_per_op.begin(), cycles_per_op.end());
+
+        Result r;
+        r.name = b.name;
+        r.ops = ops;
+        r.median_ns = per_op[per_op.size() / 2];
+        r.p99_ns = per_op[(per_op.size() - 1) * 99 / 100];
+        r.min_ns = per_op.front();
+        r.cycles_per_op = cycles_per_op[cycles_per_op.size() / 2];
+        return r;
+    }
+
+    std::vector<Benchmark> benchmarks_;
+};
+
+} // namespace bench
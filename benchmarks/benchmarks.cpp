@@ -0,0 +1,197 @@
+#include "bench.hpp"
+#include "zephyr_sim.h"
+#include "thermal_plant.hpp"
+#include "TemperatureProcessor.hpp"
+#include "NtcThermistor.hpp"
+#include "PIDController.hpp"
+#include "UartLogger.hpp"
+#include "VariableFan.hpp"
+#include "GpioFan.hpp"
+#include "GpioPort.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "CommandProtocol.hpp"
+#include "TemperatureEstimator.hpp"
+#include "PlantIdentifier.hpp"
+#include <cmath>
+#include <vector>
+
+// Hot-path micro-benchmarks. Inputs cycle through a small precomputed
+// table so the compiler cannot fold the work and branches see realistic
+// variation.
+//
+// Usage: benchmarks [--filter name] [--reps n] [--warmup n]
+//                   [--json out.json] [--compare baseline.json] [--threshold pct]
+
+static constexpr size_t kInputs = 1024;
+
+int main(int argc, char** argv) {
+    bench::Options options;
+    if (!bench::Runner::parseArgs(argc, argv, options)) {
+        fprintf(stderr, "usage: %s [--filter name] [--reps n] [--warmup n] [--json file] "
+                        "[--compare baseline.json] [--threshold percent]\n", argv[0]);
+        return 2;
+    }
+
+    uint16_t raw[kInputs];
+    float temps[kInputs];
+    float duties[kInputs];
+    uint32_t lcg = 12345;
+    for (size_t i = 0; i < kInputs; i++) {
+        lcg = lcg * 1664525u + 1013904223u;
+        raw[i] = static_cast<uint16_t>(700 + (lcg >> 8) % 600);
+        temps[i] = TemperatureProcessor::toCelsius(raw[i]);
+        duties[i] = static_cast<float>((lcg >> 4) % 1000) / 10.0f;
+    }
+
+    bench::Runner runner;
+
+    runner.add("toCelsius", [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; i++) {
+            bench::doNotOptimize(TemperatureProcessor::toCelsius(raw[i % kInputs]));
+        }
+    });
+
+    // NTC conversion: compile-time table vs the Beta equation with log()
+    runner.add("NtcTable::toCelsius", [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; i++) {
+            bench::doNotOptimize(Ntc10kTable::toCelsius(raw[i % kInputs] * 3));
+        }
+    });
+
+    runner.add("NtcBetaEquation/logf", [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; i++) {
+            float code = static_cast<float>(raw[i % kInputs] * 3);
+            float r = 10000.0f * code / (4096.0f - code);
+            float celsius = 1.0f / (1.0f / 298.15f + std::log(r / 10000.0f) / 3950.0f) - 273.15f;
+            bench::doNotOptimize(celsius);
+        }
+    });
+
+    PIDController pid;
+    runner.add("PIDController::update", [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; i++) {
+            bench::doNotOptimize(pid.update(temps[i % kInputs]));
+        }
+    });
+
+    UartDriver uart;
+    uart.setEcho(false);
+    UartLogger logger(uart);
+    runner.add("UartLogger::log", [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; i++) {
+            logger.log(temps[i % kInputs]);
+        }
+    });
+
+    // Changing duty: every call quantizes and writes the PWM
+    PwmDriver pwm;
+    VariableFan fan(pwm);
+    runner.add("VariableFan::setOutput", [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; i++) {
+            fan.setOutput(duties[i % kInputs]);
+        }
+        bench::doNotOptimize(pwm.getPulseCycles());
+    });
+
+    // Steady duty: the write is suppressed after the first call
+    runner.add("VariableFan::setOutput/same", [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; i++) {
+            fan.setOutput(42.0f);
+        }
+        bench::doNotOptimize(pwm.getPulseCycles());
+    });
+
+    // 32 on/off fans per cycle, one of them switching each cycle: one
+    // driver call per fan vs shadow bits and a single port commit
+    constexpr int kGpioFans = 32;
+    uint32_t patterns[kInputs];
+    uint32_t pattern = 0x0000FFFFu;
+    for (size_t i = 0; i < kInputs; i++) {
+        lcg = lcg * 1664525u + 1013904223u;
+        pattern ^= 1u << (lcg >> 27);
+        patterns[i] = pattern;
+    }
+    GpioDriver pins[kGpioFans];
+    std::vector<GpioFan> per_pin;
+    for (GpioDriver& pin : pins) {
+        pin.setEcho(false);
+        per_pin.emplace_back(pin);
+    }
+    runner.add("GpioFan x32/per-pin", [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; i++) {
+            uint32_t pattern = patterns[i % kInputs];
+            for (int fan = 0; fan < kGpioFans; fan++) {
+                if (pattern & (1u << fan)) per_pin[fan].activate();
+                else per_pin[fan].deactivate();
+            }
+        }
+        bench::doNotOptimize(pins[0].getWriteCount());
+    });
+
+    GpioPortDriver port_driver;
+    GpioPort port(port_driver);
+    std::vector<GpioFan> batched;
+    for (int fan = 0; fan < kGpioFans; fan++) batched.emplace_back(port, static_cast<uint8_t>(fan));
+    runner.add("GpioFan x32/port-commit", [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; i++) {
+            uint32_t pattern = patterns[i % kInputs];
+            for (int fan = 0; fan < kGpioFans; fan++) {
+                if (pattern & (1u << fan)) batched[fan].activate();
+                else batched[fan].deactivate();
+            }
+            port.commit();
+        }
+        bench::doNotOptimize(port_driver.getWriteCount());
+    });
+
+    // Kalman predict + correct with the fan curve lookup
+    TemperatureEstimator estimator;
+    runner.add("TemperatureEstimator::update", [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; i++) {
+            estimator.update(temps[i % kInputs], 1.0f, duties[i % kInputs]);
+        }
+        bench::doNotOptimize(estimator.temperature());
+    });
+
+    // Four 3x3 RLS steps (one per candidate dead time); the cost is fixed
+    PlantIdentifier identifier;
+    runner.add("PlantIdentifier::update", [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; i++) {
+            identifier.update(temps[i % kInputs], duties[i % kInputs], 1.0f);
+        }
+        bench::doNotOptimize(identifier.getStats().updates);
+    });
+
+    // Full regulation cycle: sensor read, statistics, PID, fan, UART log.
+    // The plant advances once per batch so its integration is not timed.
+    ThermalPlant plant;
+    PlantSensor sensor(plant, 0.05f);
+    PwmDriver loop_pwm;
+    VariableFan loop_fan(loop_pwm);
+    AdvancedTemperatureController controller(sensor, loop_fan, logger);
+    controller.setDetailedTrace(false);
+    runner.add("regulate", [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; i++) {
+            controller.regulate();
+        }
+        plant.step(loop_fan.getAirflow(), 1.0f);
+    });
+
+    // Largest frame the protocol allows: ring push, in-place CRC over 67
+    // bytes, table lookup and the (unknown-command) reply
+    StaticByteRing<256> rx;
+    CommandServer server(rx, uart, controller);
+    uint8_t frame[protocol::kMaxFrame] = {protocol::kStartOfFrame, protocol::kMaxPayload, 0x7F, 0};
+    for (size_t i = 0; i < protocol::kMaxPayload; i++) frame[protocol::kHeaderSize + i] = static_cast<uint8_t>(i);
+    uint16_t crc = crc::crc16(frame + 1, protocol::kMaxFrame - 3);
+    frame[protocol::kMaxFrame - 2] = static_cast<uint8_t>(crc);
+    frame[protocol::kMaxFrame - 1] = static_cast<uint8_t>(crc >> 8);
+    runner.add("CommandServer::poll/max-frame", [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; i++) {
+            rx.push(frame, sizeof(frame));
+            bench::doNotOptimize(server.poll(0));
+        }
+    });
+
+    return runner.run(options);
+}
@@ -0,0 +1,107 @@
+#include "thermal_plant.hpp"
+#include "VariableFan.hpp"
+#include "LinearizedActuator.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "AdaptiveSampler.hpp"
+#include <cmath>
+#include <cstdio>
+
+// Fixed-rate vs adaptive sampling over six simulated hours.
+// The heat load steps sharply three times; between steps the enclosure is
+// stable. Runs in virtual time: the plant is advanced by each period
+// instead of sleeping.
+
+class NullLogger : public ILogger {
+public:
+    void log(float) override {}
+};
+
+struct RunResult {
+    uint32_t wakeups;
+    float peak_deviation;
+    float iae;            // Integrated absolute error (°C·s)
+};
+
+static const float kHours = 6.0f;
+
+static float heatLoadAt(float t) {
+    if (t < 3600.0f) return 20.0f;
+    if (t < 3.0f * 3600.0f) return 40.0f;
+    if (t < 4.5f * 3600.0f) return 15.0f;
+    return 30.0f;
+}
+
+// period_ms == 0 selects the adaptive scheduler
+static RunResult run(uint32_t fixed_period_ms) {
+    ThermalPlant::Params params;
+    params.initial = 30.0f;
+    params.sensor_lag = 10.0f;
+    params.heat_load = heatLoadAt(0.0f);
+    ThermalPlant plant(params);
+    PlantSensor sensor(plant, 0.05f);
+    VariableFan fan;
+    LinearizedActuator<VariableFan::Curve> actuator(fan);
+    NullLogger logger;
+
+    PIDController::Config config;
+    config.kp = 8.0f;
+    config.ki = 0.4f;
+    config.kd = 2.0f;
+    config.setpoint = 30.0f;
+    config.integral_max = config.output_max / config.ki;
+    AdvancedTemperatureController controller(sensor, actuator, logger, config);
+    controller.setDetailedTrace(false);
+
+    AdaptiveSampler sampler;
+
+    RunResult result{0, 0.0f, 0.0f};
+    float t = 0.0f;
+    float dt = fixed_period_ms ? fixed_period_ms / 1000.0f : 1.0f;
+    const float end = kHours * 3600.0f;
+    while (t < end) {
+        controller.regulate(dt);
+        result.wakeups++;
+
+        uint32_t period_ms = fixed_period_ms;
+        if (period_ms == 0) {
+            period_ms = sampler.next(controller.getStatistics().last_temp,
+                                     controller.getPIDState().error, dt);
+        }
+        dt = period_ms / 1000.0f;
+
+        // Advance the plant in 0.25 s slices so load steps land on time
+        float remaining = dt;
+        while (remaining > 0.0f) {
+            float slice = std::min(remaining, 0.25f);
+            plant.setHeatLoad(heatLoadAt(t));
+            plant.step(fan.getAirflow(), slice);
+            t += slice;
+            remaining -= slice;
+
+            float deviation = std::fabs(plant.temperature() - config.setpoint);
+            result.iae += deviation * slice;
+            result.peak_deviation = std::max(result.peak_deviation, deviation);
+        }
+    }
+    return result;
+}
+
+int main() {
+    printf("=== Adaptive Sampling Simulation (%.0f h, load steps 20->40->15->30 W) ===\n\n", kHours);
+    printf("  %-18s %12s %14s %12s\n", "loop", "wakeups/h", "peak dev (°C)", "IAE (°C·s)");
+
+    struct Mode {
+        const char* name;
+        uint32_t period_ms;
+    };
+    const Mode modes[] = {
+        {"fixed 1 s", 1000},
+        {"fixed 5 s", 5000},
+        {"adaptive 0.25-5 s", 0},
+    };
+    for (const Mode& mode : modes) {
+        RunResult r = run(mode.period_ms);
+        printf("  %-18s %12.0f %14.3f %12.1f\n", mode.name, r.wakeups / kHours, r.peak_deviation, r.iae);
+    }
+    return 0;
+}
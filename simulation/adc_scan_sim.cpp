@@ -0,0 +1,64 @@
+#include "AdcScanGroup.hpp"
+#include <chrono>
+#include <cstdio>
+
+// Acquisition cost of N thermistors: one blocking read per channel versus
+// one scan-group transaction. Modeled bus time comes from the simulation
+// driver's timing (per-transaction setup plus per-conversion time); host
+// CPU time covers the software path only.
+
+static volatile float sink;
+
+static void compare(size_t count, int cycles) {
+    uint8_t channels[AdcScanDriver::kMaxChannels];
+    for (size_t i = 0; i < count; i++) {
+        channels[i] = static_cast<uint8_t>(i);
+    }
+
+    // Sequential: one transaction per channel
+    AdcScanDriver sequential_adc;
+    auto start = std::chrono::steady_clock::now();
+    for (int c = 0; c < cycles; c++) {
+        float sum = 0.0f;
+        for (size_t i = 0; i < count; i++) {
+            sum += TemperatureProcessor::toCelsius(sequential_adc.readChannel(channels[i]));
+        }
+        sink = sum;
+    }
+    double sequential_cpu = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / cycles;
+
+    // Scan group: one transaction per cycle, channels read through their views
+    AdcScanDriver scan_adc;
+    AdcScanGroup group(scan_adc, channels, count);
+    start = std::chrono::steady_clock::now();
+    for (int c = 0; c < cycles; c++) {
+        group.scan();
+        float sum = 0.0f;
+        for (size_t i = 0; i < count; i++) {
+            sum += group.channel(i).readValue();
+        }
+        sink = sum;
+    }
+    double scan_cpu = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / cycles;
+
+    double sequential_us = sequential_adc.getElapsedNs() / 1000.0 / cycles;
+    double scan_us = scan_adc.getElapsedNs() / 1000.0 / cycles;
+    printf("%2zu channels  sequential: %3u txn %7.1f us  |  scan: %u txn %6.1f us  (%.1fx)"
+           "  |  host CPU %6.1f vs %6.1f ns\n",
+           count, sequential_adc.getTransactionCount() / cycles, sequential_us,
+           scan_adc.getTransactionCount() / cycles, scan_us, sequential_us / scan_us,
+           sequential_cpu, scan_cpu);
+}
+
+int main() {
+    const int cycles = 100000;
+    AdcScanDriver::Timing timing;
+    printf("=== ADC Scan Group: acquisition time per cycle ===\n");
+    printf("Model: %.1f us per transaction, %.1f us per conversion\n\n",
+           timing.transaction_ns / 1000.0, timing.conversion_ns / 1000.0);
+    compare(8, cycles);
+    compare(16, cycles);
+    return 0;
+}
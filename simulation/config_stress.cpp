@@ -0,0 +1,87 @@
+#include "zephyr_sim.h"
+#include "thermal_plant.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+// Concurrent retuning while the control loop runs. Writer threads publish
+// setpoints, gains and whole configurations whose fields are derived from
+// one number, so the loop can detect a torn (mixed) configuration. Build
+// with -DTEMPCTRL_TSAN=ON to run under ThreadSanitizer.
+//
+// Usage: config_stress [writers] [cycles]
+
+static PIDController::Config makeConfig(uint32_t k) {
+    PIDController::Config config;
+    config.kp = 1.0f + k % 97;
+    config.ki = config.kp / 10.0f;
+    config.kd = config.kp / 4.0f;
+    config.setpoint = 20.0f + k % 11;
+    config.integral_max = config.kp * 8.0f;
+    return config;
+}
+
+static bool isConsistent(const PIDController::Config& c) {
+    return c.ki == c.kp / 10.0f && c.kd == c.kp / 4.0f && c.integral_max == c.kp * 8.0f;
+}
+
+int main(int argc, char** argv) {
+    int writers = argc > 1 ? std::atoi(argv[1]) : 3;
+    uint32_t cycles = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 200000;
+
+    ThermalPlant plant;
+    PlantSensor sensor(plant, 0.05f);
+    PwmDriver pwm;
+    VariableFan fan(pwm);
+    UartDriver uart;
+    uart.setEcho(false);
+    UartLogger logger(uart);
+    AdvancedTemperatureController controller(sensor, fan, logger, makeConfig(0));
+    controller.setDetailedTrace(false);
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> publishes{0};
+    std::vector<std::thread> threads;
+    for (int w = 0; w < writers; w++) {
+        threads.emplace_back([&, w]() {
+            for (uint32_t k = 1; !stop.load(std::memory_order_relaxed); k++) {
+                // Mix whole-config writes with the field-level setters
+                if (w == 0) {
+                    controller.publishConfig(makeConfig(k));
+                } else if (w == 1) {
+                    controller.setSetpoint(20.0f + k % 11);
+                } else {
+                    PIDController::Config c = makeConfig(k * 7 + w);
+                    controller.publishConfig(c);
+                }
+                publishes.fetch_add(1, std::memory_order_relaxed);
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    uint32_t torn = 0;
+    uint32_t changes = 0;
+    PIDController::Config previous = controller.getActiveConfig();
+    for (uint32_t i = 0; i < cycles; i++) {
+        controller.regulate(0.1f);
+        plant.step(fan.getAirflow(), 0.1f);
+
+        const PIDController::Config& active = controller.getActiveConfig();
+        if (!isConsistent(active)) torn++;
+        if (active.kp != previous.kp || active.setpoint != previous.setpoint) changes++;
+        previous = active;
+    }
+    stop = true;
+    for (auto& t : threads) t.join();
+
+    printf("=== Config channel stress: %d writers, %u cycles ===\n", writers, cycles);
+    printf("Publishes:          %llu\n", static_cast<unsigned long long>(publishes.load()));
+    printf("Configs applied:    %u\n", changes);
+    printf("Torn configs seen:  %u\n", torn);
+    return torn == 0 ? 0 : 1;
+}
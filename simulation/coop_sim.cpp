@@ -0,0 +1,331 @@
+#include "thermal_plant.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "CoopScheduler.hpp"
+#include <pthread.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// Many control loops as coroutines on one thread, against one OS thread
+// per loop. Each controller awaits its tick, then its ADC conversion on a
+// shared sequential ADC, then room in a shared UART TX FIFO, all in
+// virtual time. Reports the frame size per controller, the cost of a
+// coroutine switch vs a thread switch, and the memory per thread.
+//
+// Usage: coop_sim [controllers] [minutes]
+
+namespace {
+
+const uint64_t kPeriodUs = 1000000;        // Control period
+const uint64_t kConversionUs = 20;         // One ADC conversion
+const uint64_t kByteTimeUs = 10;           // UART at 1 Mbaud
+const uint32_t kTxFifoBytes = 256;
+const uint32_t kMaxMessage = 32;
+
+/**
+ * Shared UART: loggers append to a TX FIFO that drains at the baud rate;
+ * a controller that finds no room for a message waits for `ready`
+ */
+class SimUart {
+public:
+    explicit SimUart(CoopScheduler& sched) : ready(sched), has_data_(sched) {}
+
+    uint32_t freeBytes() const { return kTxFifoBytes - pending_; }
+
+    void enqueue(uint32_t bytes) {
+        pending_ += bytes;
+        sent_ += bytes;
+        has_data_.signal();
+    }
+
+    // Static: a task's first parameter must be its scheduler
+    static CoopTask transmitter(CoopScheduler& sched, SimUart& uart) {
+        for (;;) {
+            while (uart.pending_ == 0) co_await uart.has_data_.wait();
+            uint32_t chunk = uart.pending_ < 16 ? uart.pending_ : 16;
+            co_await sched.sleepFor(chunk * kByteTimeUs);
+            uart.pending_ -= chunk;
+            uart.ready.signal();
+        }
+    }
+
+    CoopEvent ready;
+    uint64_t sent_ = 0;
+    uint64_t stalls = 0;
+
+private:
+    CoopEvent has_data_;
+    uint32_t pending_ = 0;
+};
+
+class CoopUartLogger : public ILogger {
+public:
+    explicit CoopUartLogger(SimUart& uart) : uart_(uart) {}
+    void log(float val) override {
+        char buf[kMaxMessage];
+        snprintf(buf, sizeof(buf), "Temp=%.2f°C\n", val);
+        uart_.enqueue(static_cast<uint32_t>(strlen(buf)));
+    }
+
+private:
+    SimUart& uart_;
+};
+
+struct Zone {
+    Zone(CoopScheduler& sched, SimUart& uart, int index)
+        : plant(params(index)), sensor(plant, 0.05f, index + 1), logger(uart),
+          controller(sensor, fan, logger, config()), sensor_ready(sched) {
+        controller.setDetailedTrace(false);
+        controller.setSnapshotPublishing(false);
+    }
+
+    static ThermalPlant::Params params(int index) {
+        ThermalPlant::Params p;
+        p.heat_load = 15.0f + index % 7 * 3.0f;
+        p.initial = 30.0f + index % 5;
+        return p;
+    }
+
+    static PIDController::Config config() {
+        PIDController::Config c;
+        c.kp = 8.0f;
+        c.ki = 0.4f;
+        c.kd = 2.0f;
+        c.setpoint = 30.0f;
+        c.integral_max = c.output_max / c.ki;
+        return c;
+    }
+
+    ThermalPlant plant;
+    PlantSensor sensor;
+    VariableFan fan;
+    CoopUartLogger logger;
+    AdvancedTemperatureController controller;
+    CoopEvent sensor_ready;
+};
+
+/**
+ * Shared ADC: conversion requests are served in order, one at a time
+ */
+class SimAdc {
+public:
+    SimAdc(CoopScheduler& sched, size_t capacity) : requests_(capacity), pending_(sched) {}
+
+    void start(Zone& zone) {
+        requests_[(head_ + count_++) % requests_.size()] = &zone;
+        pending_.signal();
+    }
+
+    static CoopTask sequencer(CoopScheduler& sched, SimAdc& adc) {
+        for (;;) {
+            while (adc.count_ == 0) co_await adc.pending_.wait();
+            Zone* zone = adc.requests_[adc.head_];
+            adc.head_ = (adc.head_ + 1) % adc.requests_.size();
+            adc.count_--;
+            co_await sched.sleepFor(kConversionUs);
+            zone->sensor_ready.signal();
+        }
+    }
+
+private:
+    std::vector<Zone*> requests_;
+    size_t head_ = 0;
+    size_t count_ = 0;
+    CoopEvent pending_;
+};
+
+CoopTask controlLoop(CoopScheduler& sched, Zone& zone, SimAdc& adc, SimUart& uart, uint64_t offset_us) {
+    uint64_t next = offset_us;
+    for (;;) {
+        co_await sched.sleepUntil(next);
+        next += kPeriodUs;
+
+        adc.start(zone);
+        co_await zone.sensor_ready.wait();
+
+        while (uart.freeBytes() < kMaxMessage) {
+            uart.stalls++;
+            co_await uart.ready.wait();
+        }
+        zone.controller.regulate(kPeriodUs / 1e6f);
+        zone.plant.step(zone.fan.getAirflow(), kPeriodUs / 1e6f);
+    }
+}
+
+CoopTask pingPong(CoopScheduler&, CoopEvent& mine, CoopEvent& theirs, uint32_t rounds) {
+    for (uint32_t i = 0; i < rounds; i++) {
+        theirs.signal();
+        co_await mine.wait();
+    }
+    theirs.signal();
+}
+
+double coroutineSwitchNs(uint32_t rounds) {
+    StaticFramePool<320, 2> pool;
+    CoopScheduler sched(pool);
+    CoopEvent a(sched);
+    CoopEvent b(sched);
+    sched.spawn(pingPong(sched, a, b, rounds));
+    sched.spawn(pingPong(sched, b, a, rounds));
+    auto start = std::chrono::steady_clock::now();
+    sched.runReady();
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return ns / sched.getStats().resumes;
+}
+
+double threadSwitchNs(uint32_t rounds) {
+    std::mutex mutex;
+    std::condition_variable cv;
+    uint32_t turn = 0;      // Even: ping's move, odd: pong's
+    auto player = [&](uint32_t parity) {
+        for (uint32_t i = 0; i < rounds; i++) {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&] { return turn % 2 == parity; });
+            turn++;
+            cv.notify_one();
+        }
+    };
+    auto start = std::chrono::steady_clock::now();
+    std::thread pong(player, 1u);
+    player(0);
+    pong.join();
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return ns / (2.0 * rounds);
+}
+
+long residentKb() {
+    long pages = 0;
+    long resident = 0;
+    if (FILE* f = fopen("/proc/self/statm", "r")) {
+        if (fscanf(f, "%ld %ld", &pages, &resident) != 2) resident = 0;
+        fclose(f);
+    }
+    return resident * sysconf(_SC_PAGESIZE) / 1024;
+}
+
+// Resident growth of parked threads (each one a blocked control loop)
+double threadResidentKb(int threads) {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool release = false;
+    int parked = 0;
+    long before = residentKb();
+    std::vector<std::thread> pool;
+    for (int i = 0; i < threads; i++) {
+        pool.emplace_back([&] {
+            std::unique_lock<std::mutex> lock(mutex);
+            parked++;
+            cv.notify_all();
+            cv.wait(lock, [&] { return release; });
+        });
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return parked == threads; });
+    }
+    long after = residentKb();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        release = true;
+    }
+    cv.notify_all();
+    for (auto& t : pool) t.join();
+    return static_cast<double>(after - before) / threads;
+}
+
+size_t defaultStackKb() {
+    pthread_attr_t attr;
+    size_t stack = 0;
+    pthread_attr_init(&attr);
+    pthread_attr_getstacksize(&attr, &stack);
+    pthread_attr_destroy(&attr);
+    return stack / 1024;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int controllers = argc > 1 ? std::atoi(argv[1]) : 1000;
+    int minutes = argc > 2 ? std::atoi(argv[2]) : 10;
+    if (controllers <= 0 || minutes <= 0) {
+        fprintf(stderr, "usage: %s [controllers] [minutes]\n", argv[0]);
+        return 2;
+    }
+
+    printf("=== Coroutine Scheduling: %d controllers, %d min virtual time, one thread ===\n\n",
+           controllers, minutes);
+
+    // One block per controller plus the ADC and UART servers
+    constexpr size_t kFrameBlock = 320;
+    size_t blocks = static_cast<size_t>(controllers) + 2;
+    std::vector<std::max_align_t> storage(kFrameBlock * blocks / sizeof(std::max_align_t));
+    FramePool pool(storage.data(), kFrameBlock, blocks);
+    size_t zone_bytes = 0;
+    {
+        CoopScheduler sched(pool);
+        SimUart uart(sched);
+        SimAdc adc(sched, controllers);
+        std::vector<std::unique_ptr<Zone>> zones;
+        for (int i = 0; i < controllers; i++) {
+            zones.push_back(std::make_unique<Zone>(sched, uart, i));
+        }
+        zone_bytes = sizeof(Zone);
+
+        bool spawned = sched.spawn(SimUart::transmitter(sched, uart)) &&
+                       sched.spawn(SimAdc::sequencer(sched, adc));
+        for (int i = 0; i < controllers && spawned; i++) {
+            // Stagger start times across the period so ADC requests do not all collide
+            uint64_t offset = kPeriodUs * static_cast<uint64_t>(i) / controllers;
+            spawned = sched.spawn(controlLoop(sched, *zones[i], adc, uart, offset));
+        }
+        if (!spawned) {
+            printf("Frame pool too small: largest frame %zu bytes, block %zu\n",
+                   pool.largestRequest(), pool.blockSize());
+            return 1;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        sched.advanceTo(static_cast<uint64_t>(minutes) * 60 * kPeriodUs);
+        double wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        uint64_t cycles = 0;
+        float worst_error = 0.0f;
+        for (const auto& zone : zones) {
+            cycles += zone->controller.getStatistics().total_cycles;
+            float error = zone->plant.temperature() - 30.0f;
+            worst_error = std::max(worst_error, error < 0 ? -error : error);
+        }
+
+        const CoopScheduler::Stats& stats = sched.getStats();
+        printf("  Control cycles:        %llu in %.1f ms wall (%.0f ns per cycle incl. regulate)\n",
+               static_cast<unsigned long long>(cycles), wall_ms, wall_ms * 1e6 / cycles);
+        printf("  Resumes:               %llu (%.1f per cycle: tick, ADC, UART)\n",
+               static_cast<unsigned long long>(stats.resumes), static_cast<double>(stats.resumes) / cycles);
+        printf("  UART:                  %llu bytes, %llu stalls on a full FIFO\n",
+               static_cast<unsigned long long>(uart.sent_), static_cast<unsigned long long>(uart.stalls));
+        printf("  Worst final |error|:   %.2f°C\n", worst_error);
+        printf("  Frames:                %zu live, largest %zu bytes (block %zu), %zu failed\n",
+               pool.inUse(), pool.largestRequest(), pool.blockSize(), pool.failedAllocations());
+    }
+
+    const uint32_t rounds = 1000000;
+    double coroutine_ns = coroutineSwitchNs(rounds);
+    double thread_ns = threadSwitchNs(rounds / 10);
+    size_t stack_kb = defaultStackKb();
+    double thread_kb = threadResidentKb(256);
+
+    printf("\n  %-28s %14s %14s\n", "", "coroutine", "OS thread");
+    printf("  %-28s %11.1f ns %11.1f ns\n", "switch (wake + suspend)", coroutine_ns, thread_ns);
+    printf("  %-28s %11zu B  %11zu KB\n", "loop state reserved", kFrameBlock, stack_kb);
+    printf("  %-28s %11zu B  %11.1f KB\n", "loop state resident", pool.largestRequest(), thread_kb);
+    printf("  %-28s %11zu B  %11zu B\n", "zone objects (both modes)", zone_bytes, zone_bytes);
+    return 0;
+}
@@ -0,0 +1,229 @@
+#include "thermal_plant.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "TemperatureEstimator.hpp"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// Noise rejection vs latency of the Kalman estimator against raw readings
+// and a first-order low-pass, then closed-loop control quality at longer
+// sample periods.
+//
+// Part 1 holds a fan profile open loop and compares each estimate with the
+// true (sensed) temperature and slope: RMS error, and the lag that best
+// aligns the estimate with the truth. Part 2 closes the loop through the
+// controller at 1-10 s periods with heat-load steps and reports the RMS
+// temperature error and fan activity (mean |change in duty| per second).
+
+namespace {
+
+const float kSetpoint = 28.0f;
+const float kNoise = 0.3f;          // Uniform ±0.3 °C plus 12-bit quantization
+
+ThermalPlant::Params zoneParams() {
+    ThermalPlant::Params params;
+    params.initial = kSetpoint;
+    params.sensor_lag = 3.0f;
+    return params;
+}
+
+// Fan term from the plant model; the heating rate is left to the filter
+TemperatureEstimator::Config estimatorConfig() {
+    ThermalPlant::Params params = zoneParams();
+    TemperatureEstimator::Config config;
+    config.measurement_noise = 0.18f;   // ±0.3 °C uniform: 0.17 °C std, plus quantization
+    config.fan_conductance = params.fan_loss / params.thermal_mass;
+    config.ambient = params.ambient;
+    return config;
+}
+
+float heatLoad(float t) {
+    if (t < 300.0f) return 23.0f;
+    if (t < 600.0f) return 33.0f;
+    if (t < 900.0f) return 23.0f + (t - 600.0f) * 0.03f;    // Slow ramp up
+    return 18.0f;
+}
+
+struct Track {
+    std::vector<float> value;
+    std::vector<float> slope;
+};
+
+float rms(const std::vector<float>& a, const std::vector<float>& b, size_t shift, size_t skip) {
+    double sum = 0.0;
+    size_t n = 0;
+    for (size_t i = skip + shift; i < a.size(); i++) {
+        double e = a[i] - b[i - shift];
+        sum += e * e;
+        n++;
+    }
+    return n ? static_cast<float>(std::sqrt(sum / n)) : 0.0f;
+}
+
+// Shift (in samples) of the truth that best matches the estimate
+size_t bestLag(const std::vector<float>& estimate, const std::vector<float>& truth, size_t skip) {
+    size_t best = 0;
+    float best_rms = rms(estimate, truth, 0, skip);
+    for (size_t shift = 1; shift < 60; shift++) {
+        float e = rms(estimate, truth, shift, skip);
+        if (e < best_rms) {
+            best_rms = e;
+            best = shift;
+        }
+    }
+    return best;
+}
+
+void openLoop() {
+    const float dt = 1.0f;
+    ThermalPlant plant(zoneParams());
+    PlantSensor sensor(plant, kNoise);
+    TemperatureEstimator kalman(estimatorConfig());
+    const float alpha = 0.2f;
+    float ema = 0.0f;
+    float ema_prev = 0.0f;
+    float raw_prev = 0.0f;
+
+    Track truth, raw, low_pass, estimate;
+    for (int t = 0; t < 1200; t++) {
+        float duty = 55.0f + 25.0f * ((t / 150) % 2 ? 1.0f : -1.0f);   // Square wave 30/80%
+        float before = plant.sensedTemperature();
+        plant.step(VariableFan::Curve::airflow(duty), dt);
+        float reading = sensor.readValue();
+
+        ema = t == 0 ? reading : ema + alpha * (reading - ema);
+        kalman.update(reading, dt, duty);
+
+        truth.value.push_back(plant.sensedTemperature());
+        truth.slope.push_back((plant.sensedTemperature() - before) / dt);
+        raw.value.push_back(reading);
+        raw.slope.push_back(t == 0 ? 0.0f : (reading - raw_prev) / dt);
+        low_pass.value.push_back(ema);
+        low_pass.slope.push_back(t == 0 ? 0.0f : (ema - ema_prev) / dt);
+        estimate.value.push_back(kalman.temperature());
+        estimate.slope.push_back(kalman.rate());
+        raw_prev = reading;
+        ema_prev = ema;
+    }
+
+    const size_t skip = 30;
+    printf("--- Open loop, 1 s samples, fan 30/80%% square wave, heat-load steps ---\n");
+    printf("  %-16s %12s %10s %14s %10s\n", "estimate", "temp RMS", "temp lag", "slope RMS", "slope lag");
+    auto row = [&](const char* name, const Track& track) {
+        printf("  %-16s %10.3f°C %8zu s %10.4f°C/s %8zu s\n", name, rms(track.value, truth.value, 0, skip),
+               bestLag(track.value, truth.value, skip), rms(track.slope, truth.slope, 0, skip),
+               bestLag(track.slope, truth.slope, skip));
+    };
+    row("raw", raw);
+    row("low-pass 0.2", low_pass);
+    row("Kalman", estimate);
+    printf("\n");
+}
+
+struct LoopResult {
+    float rms_error;
+    float max_error;
+    float fan_activity;
+};
+
+enum class Mode { Raw, LowPass, Kalman };
+
+// Low-pass in front of the controller, for comparison with the estimator
+class LowPassSensor : public ISensor {
+public:
+    LowPassSensor(ISensor& source, float alpha) : source_(source), alpha_(alpha) {}
+    float readValue() override {
+        float x = source_.readValue();
+        y_ = primed_ ? y_ + alpha_ * (x - y_) : x;
+        primed_ = true;
+        return y_;
+    }
+
+private:
+    ISensor& source_;
+    float alpha_;
+    float y_ = 0.0f;
+    bool primed_ = false;
+};
+
+struct Gains {
+    const char* name;
+    float kp, ki, kd;
+};
+
+LoopResult closedLoop(Mode mode, float period, const Gains& gains) {
+    ThermalPlant plant(zoneParams());
+    PlantSensor noisy(plant, kNoise);
+    LowPassSensor filtered(noisy, 0.3f);
+    ISensor& sensor = mode == Mode::LowPass ? static_cast<ISensor&>(filtered) : noisy;
+    VariableFan fan;
+    UartDriver uart;
+    uart.setEcho(false);
+    UartLogger logger(uart);
+
+    PIDController::Config config;
+    config.kp = gains.kp;
+    config.ki = gains.ki;
+    config.kd = gains.kd;
+    config.setpoint = kSetpoint;
+    config.integral_max = config.output_max / config.ki;
+    AdvancedTemperatureController controller(sensor, fan, logger, config);
+    controller.setDetailedTrace(false);
+    controller.setSnapshotPublishing(false);
+    TemperatureEstimator kalman(estimatorConfig());
+    if (mode == Mode::Kalman) controller.setEstimator(&kalman);
+
+    const float duration = 1200.0f;
+    double sum_sq = 0.0;
+    float max_error = 0.0f;
+    float activity = 0.0f;
+    float last_duty = 0.0f;
+    int samples = 0;
+    for (float t = 0.0f; t < duration; t += period) {
+        plant.setHeatLoad(heatLoad(t));
+        controller.regulate(period);
+        activity += std::fabs(fan.getOutput() - last_duty);
+        last_duty = fan.getOutput();
+        // Integrate the error between samples too
+        for (float s = 0.0f; s < period; s += 0.5f) {
+            plant.step(fan.getAirflow(), 0.5f);
+            float error = plant.temperature() - kSetpoint;
+            if (t > 60.0f) {
+                sum_sq += error * error;
+                max_error = std::max(max_error, std::fabs(error));
+                samples++;
+            }
+        }
+    }
+    return {static_cast<float>(std::sqrt(sum_sq / samples)), max_error, activity / duration};
+}
+
+} // namespace
+
+int main() {
+    printf("=== Temperature Estimator Simulation ===\n\n");
+    openLoop();
+
+    const Gains gain_sets[] = {
+        {"kp 8 ki 0.4 kd 10", 8.0f, 0.4f, 10.0f},
+        {"kp 20 ki 1 kd 30", 20.0f, 1.0f, 30.0f},
+    };
+    const float periods[] = {1.0f, 2.0f, 5.0f, 10.0f};
+    const Mode modes[] = {Mode::Raw, Mode::LowPass, Mode::Kalman};
+    const char* names[] = {"raw", "low-pass", "Kalman"};
+    for (const Gains& gains : gain_sets) {
+        printf("--- Closed loop, heat-load steps and ramp, %s ---\n", gains.name);
+        printf("  %-8s %-10s %12s %12s %16s\n", "period", "input", "RMS error", "max error", "fan activity");
+        for (float period : periods) {
+            for (int m = 0; m < 3; m++) {
+                LoopResult result = closedLoop(modes[m], period, gains);
+                printf("  %5.0f s  %-10s %10.3f°C %10.3f°C %12.2f %%/s\n", period, names[m], result.rms_error,
+                       result.max_error, result.fan_activity);
+            }
+        }
+        printf("\n");
+    }
+    return 0;
+}
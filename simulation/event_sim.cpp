@@ -0,0 +1,123 @@
+#include "thermal_plant.hpp"
+#include "VariableFan.hpp"
+#include "LinearizedActuator.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include <cmath>
+#include <cstdio>
+#include <chrono>
+
+// Periodic vs send-on-delta regulation over a simulated 24-hour day.
+// Ambient follows a daily cycle and the heat load steps twice, so most of
+// the day is flat with a few transients. The UART logger is replaced by a
+// byte counter using the same message format as UartLogger.
+
+class CountingLogger : public ILogger {
+public:
+    void log(float val) override {
+        char buf[64];
+        int n = snprintf(buf, sizeof(buf), "Temp=%.2f°C\n", val);
+        bytes += static_cast<uint32_t>(n);
+        messages++;
+    }
+    uint32_t bytes = 0;
+    uint32_t messages = 0;
+};
+
+struct DayResult {
+    uint32_t processed;
+    uint32_t uart_bytes;
+    double cpu_ms;
+    float rms_error;
+    float max_error;
+};
+
+// Cost of the timestamp pair itself, subtracted so only regulate() is counted
+static double timerOverheadMs(int samples) {
+    using Clock = std::chrono::steady_clock;
+    Clock::duration total{};
+    for (int i = 0; i < samples; i++) {
+        Clock::time_point start = Clock::now();
+        total += Clock::now() - start;
+    }
+    return std::chrono::duration<double, std::milli>(total).count();
+}
+
+static DayResult runDay(const AdvancedTemperatureController::EventConfig& events) {
+    ThermalPlant::Params params;
+    params.initial = 30.0f;
+    params.sensor_lag = 10.0f;
+    ThermalPlant plant(params);
+    PlantSensor sensor(plant, 0.05f);
+    VariableFan fan;
+    LinearizedActuator<VariableFan::Curve> actuator(fan);
+    CountingLogger logger;
+
+    PIDController::Config config;
+    config.kp = 8.0f;
+    config.ki = 0.4f;
+    config.kd = 2.0f;
+    config.setpoint = 30.0f;
+    config.integral_max = config.output_max / config.ki;
+
+    AdvancedTemperatureController controller(sensor, actuator, logger, config);
+    controller.setDetailedTrace(false);
+    controller.setEventMode(events);
+
+    const int seconds = 24 * 3600;
+    using Clock = std::chrono::steady_clock;
+    Clock::duration busy{};
+    double sq_error = 0.0;
+    float max_error = 0.0f;
+    for (int t = 0; t < seconds; t++) {
+        plant.setAmbient(22.0f + 3.0f * std::sin(2.0f * 3.14159265f * t / seconds));
+        if (t == 8 * 3600) plant.setHeatLoad(35.0f);
+        if (t == 18 * 3600) plant.setHeatLoad(18.0f);
+
+        Clock::time_point start = Clock::now();
+        controller.regulate();
+        busy += Clock::now() - start;
+
+        plant.step(fan.getAirflow(), 1.0f);
+
+        float error = std::fabs(plant.temperature() - config.setpoint);
+        sq_error += error * error;
+        max_error = std::max(max_error, error);
+    }
+
+    const auto& stats = controller.getStatistics();
+    double cpu_ms = std::chrono::duration<double, std::milli>(busy).count() - timerOverheadMs(seconds);
+    return {stats.total_cycles - stats.skipped_cycles, logger.bytes, cpu_ms,
+            static_cast<float>(std::sqrt(sq_error / seconds)), max_error};
+}
+
+int main() {
+    printf("=== Send-on-Delta Regulation Simulation (24 h at 1 Hz) ===\n\n");
+    printf("  %-24s %10s %11s %9s %9s %9s\n",
+           "mode", "processed", "UART bytes", "CPU (ms)", "RMS err", "max err");
+
+    AdvancedTemperatureController::EventConfig periodic;
+    periodic.enabled = false;
+
+    const float deadbands[] = {0.1f, 0.2f, 0.5f};
+    DayResult base = runDay(periodic);
+    printf("  %-24s %10u %11u %9.1f %9.3f %9.3f\n", "periodic",
+           base.processed, base.uart_bytes, base.cpu_ms, base.rms_error, base.max_error);
+
+    for (float deadband : deadbands) {
+        AdvancedTemperatureController::EventConfig events;
+        events.enabled = true;
+        events.deadband = deadband;
+        events.max_silent_cycles = 60;
+        DayResult r = runDay(events);
+
+        char name[32];
+        snprintf(name, sizeof(name), "on-delta %.1f°C / 60 s", deadband);
+        printf("  %-25s %10u %11u %9.1f %9.3f %9.3f\n", name,
+               r.processed, r.uart_bytes, r.cpu_ms, r.rms_error, r.max_error);
+        printf("  %-24s %9.1f%% %10.1f%% %8.1f%%\n", "  saved",
+               100.0f * (base.processed - r.processed) / base.processed,
+               100.0f * (base.uart_bytes - r.uart_bytes) / base.uart_bytes,
+               100.0 * (base.cpu_ms - r.cpu_ms) / base.cpu_ms);
+    }
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include "thermal_plant.hpp"
+#include "FanBank.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include <cmath>
+#include <cstdio>
+
+// Fan-bank staging: least power vs equal vs sequential.
+//
+// Part 1 sweeps the requested bank airflow and prints the bank's electrical
+// power under each strategy (6 W rated fans, 0.3 W each while running).
+// Part 2 regulates an enclosure cooled by the bank through a day of heat
+// load (per four fans: light 15-60 W or heavy 40-180 W, peaking in the
+// afternoon) and reports the fans' energy, how often a fan started or
+// stopped, and the temperature error.
+
+namespace {
+
+const float kSetpoint = 28.0f;
+const FanBank::Staging kStrategies[] = {FanBank::Staging::Optimal, FanBank::Staging::Equal,
+                                        FanBank::Staging::Sequential};
+const char* kNames[] = {"least power", "equal", "sequential"};
+
+float sweepPower(size_t fans, FanBank::Staging staging, float airflow) {
+    VariableFan storage[FanBank::kMaxFans];
+    VariableFan* pointers[FanBank::kMaxFans];
+    for (size_t i = 0; i < fans; i++) pointers[i] = &storage[i];
+    FanBank::Config config;
+    config.staging = staging;
+    FanBank bank(pointers, fans, config);
+    bank.setOutput(airflow);
+    return bank.estimatedPower();
+}
+
+struct DayResult {
+    float energy_kj;
+    float peak_w;
+    uint32_t stage_changes;
+    float rms_error;
+};
+
+struct Load {
+    const char* name;
+    float low;      // W per four fans, at 04:00
+    float high;     // At 16:00
+};
+
+const Load kLoads[] = {{"light", 15.0f, 60.0f}, {"heavy", 40.0f, 180.0f}};
+
+float heatLoad(const Load& load, int second, size_t fans) {
+    const float kPi = 3.14159265f;
+    float phase = 2.0f * kPi * (second - 4 * 3600) / (24.0f * 3600.0f);
+    float watts = 0.5f * (load.low + load.high) - 0.5f * (load.high - load.low) * std::cos(phase);
+    return watts * fans / 4.0f;
+}
+
+DayResult runDay(const Load& load, size_t fans, FanBank::Staging staging) {
+    ThermalPlant::Params params;
+    params.fan_loss = 9.0f * fans;
+    params.thermal_mass = 60.0f * fans;
+    params.heat_load = heatLoad(load, 0, fans);
+    params.initial = kSetpoint;
+    ThermalPlant plant(params);
+    PlantSensor sensor(plant, 0.05f);
+
+    VariableFan storage[FanBank::kMaxFans];
+    VariableFan* pointers[FanBank::kMaxFans];
+    for (size_t i = 0; i < fans; i++) pointers[i] = &storage[i];
+    FanBank::Config bank_config;
+    bank_config.staging = staging;
+    FanBank bank(pointers, fans, bank_config);
+
+    UartDriver uart;
+    uart.setEcho(false);
+    UartLogger logger(uart);
+    PIDController::Config config;
+    config.kp = 10.0f;
+    config.ki = 0.5f;
+    config.kd = 0.0f;
+    config.setpoint = kSetpoint;
+    config.integral_max = config.output_max / config.ki;
+    AdvancedTemperatureController controller(sensor, bank, logger, config);
+    controller.setDetailedTrace(false);
+    controller.setSnapshotPublishing(false);
+
+    // Settle at the night load first
+    for (int i = 0; i < 600; i++) {
+        controller.regulate(1.0f);
+        plant.step(bank.getAirflow(), 1.0f);
+    }
+
+    const float dt = 1.0f;
+    DayResult result{0.0f, 0.0f, 0, 0.0f};
+    uint32_t changes_before = bank.getStageChanges();
+    double energy = 0.0;
+    double sum_sq = 0.0;
+    int n = 0;
+    for (int second = 0; second < 24 * 3600; second++) {
+        plant.setHeatLoad(heatLoad(load, second, fans));
+        controller.regulate(dt);
+        plant.step(bank.getAirflow(), dt);
+        float power = bank.estimatedPower();
+        energy += power * dt;
+        result.peak_w = std::max(result.peak_w, power);
+        float error = plant.temperature() - kSetpoint;
+        sum_sq += error * error;
+        n++;
+    }
+    result.energy_kj = static_cast<float>(energy / 1000.0);
+    result.stage_changes = bank.getStageChanges() - changes_before;
+    result.rms_error = static_cast<float>(std::sqrt(sum_sq / n));
+    return result;
+}
+
+} // namespace
+
+int main() {
+    const size_t kBanks[] = {2, 4, 8};
+    FanBank::Config defaults;
+
+    printf("=== Fan Bank Staging Simulation ===\n\n");
+    printf("Per fan: %.1f W at full airflow (cube of speed) + %.1f W while running\n\n", defaults.rated_watts,
+           defaults.running_watts);
+    for (size_t fans : kBanks) {
+        printf("--- %zu fans: bank power (W) by requested airflow ---\n", fans);
+        printf("  %-12s", "airflow");
+        for (int airflow = 10; airflow <= 100; airflow += 10) printf(" %5d%%", airflow);
+        printf("\n");
+        for (int s = 0; s < 3; s++) {
+            printf("  %-12s", kNames[s]);
+            for (int airflow = 10; airflow <= 100; airflow += 10) {
+                printf(" %6.2f", sweepPower(fans, kStrategies[s], static_cast<float>(airflow)));
+            }
+            printf("\n");
+        }
+        printf("\n");
+    }
+
+    for (const Load& load : kLoads) {
+        for (size_t fans : kBanks) {
+            printf("--- %zu fans, one %s day at %.0f °C (%.0f-%.0f W) ---\n", fans, load.name, kSetpoint,
+                   load.low * fans / 4.0f, load.high * fans / 4.0f);
+            printf("  %-12s %10s %10s %16s %10s\n", "staging", "energy", "peak", "fan starts/stops", "RMS error");
+            DayResult results[3];
+            for (int s = 0; s < 3; s++) results[s] = runDay(load, fans, kStrategies[s]);
+            for (int s = 0; s < 3; s++) {
+                printf("  %-12s %7.1f kJ %8.2f W %16u %8.3f°C", kNames[s], results[s].energy_kj, results[s].peak_w,
+                       results[s].stage_changes, results[s].rms_error);
+                if (s > 0) printf("   least power saves %.0f%%", 100.0f * (1.0f - results[0].energy_kj / results[s].energy_kj));
+                printf("\n");
+            }
+            printf("\n");
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,219 @@
+#include "thermal_plant.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Fleet capacity planning: thousands of independent zones, each a
+// randomized thermal plant with its own sensor, fan and controller, run
+// under virtual time (1 s control period, no sleeping) on every core.
+// Each candidate gain set regulates the same fleet, and the aggregate
+// overshoot, settling, fan energy and worst zones are compared.
+//
+// Usage: fleet_sim [zones] [minutes] [threads] [seed]
+
+namespace {
+
+const float kSetpoint = 30.0f;
+const float kSettleBand = 0.5f;        // °C around the setpoint
+const float kFanRatedWatts = 4.0f;     // Fan power at 100% airflow (cube law)
+
+struct GainSet {
+    const char* name;
+    float kp;
+    float ki;
+    float kd;
+};
+
+struct ZoneResult {
+    ThermalPlant::Params params;
+    float overshoot = 0.0f;            // Past the setpoint after the first crossing (°C)
+    float settle_s = 0.0f;             // Last time outside the settle band
+    float steady_error = 0.0f;         // Mean |error| over the last quarter
+    float iae = 0.0f;                  // Integrated |error| (°C·s)
+    float energy_wh = 0.0f;            // Fan energy
+    bool out_of_range = false;         // Setpoint unreachable at any airflow
+};
+
+// Same fleet for every gain set: the zone's parameters depend only on its index
+ThermalPlant::Params zoneParams(uint32_t seed, uint32_t zone) {
+    std::mt19937 rng(seed * 1000003u + zone);
+    auto uniform = [&rng](float lo, float hi) {
+        return std::uniform_real_distribution<float>(lo, hi)(rng);
+    };
+    ThermalPlant::Params params;
+    params.ambient = uniform(18.0f, 28.0f);
+    params.heat_load = uniform(10.0f, 40.0f);
+    params.thermal_mass = uniform(30.0f, 150.0f);
+    params.passive_loss = uniform(0.5f, 1.5f);
+    params.fan_loss = uniform(5.0f, 12.0f);
+    params.sensor_lag = uniform(0.0f, 20.0f);
+    params.initial = uniform(32.0f, 40.0f);
+    return params;
+}
+
+ZoneResult runZone(const GainSet& gains, const ThermalPlant::Params& params, int seconds, uint32_t zone) {
+    ThermalPlant plant(params);
+    PlantSensor sensor(plant, 0.05f, zone + 1);
+    VariableFan fan;
+    UartDriver uart;
+    uart.setEcho(false);
+    UartLogger logger(uart);
+
+    PIDController::Config config;
+    config.kp = gains.kp;
+    config.ki = gains.ki;
+    config.kd = gains.kd;
+    config.setpoint = kSetpoint;
+    config.integral_max = config.output_max / config.ki;
+
+    AdvancedTemperatureController controller(sensor, fan, logger, config);
+    controller.setDetailedTrace(false);
+    controller.setSnapshotPublishing(false);
+
+    ZoneResult result;
+    result.params = params;
+    // Equilibrium spans [full airflow, fan off]; outside it no gains can hold the setpoint
+    float coolest = params.ambient + params.heat_load / (params.passive_loss + params.fan_loss);
+    float warmest = params.ambient + params.heat_load / params.passive_loss;
+    result.out_of_range = kSetpoint < coolest || kSetpoint > warmest;
+
+    float direction = params.initial > kSetpoint ? 1.0f : -1.0f;
+    bool crossed = false;
+    int last_outside = 0;
+    double iae = 0.0;
+    double energy_ws = 0.0;
+    double tail_error = 0.0;
+    int tail_start = seconds - seconds / 4;
+    for (int t = 0; t < seconds; t++) {
+        controller.regulate(1.0f);
+        float airflow = fan.getAirflow();
+        plant.step(airflow, 1.0f);
+
+        float error = plant.temperature() - kSetpoint;
+        float magnitude = std::fabs(error);
+        if (!crossed && error * direction <= 0.0f) crossed = true;
+        if (crossed) result.overshoot = std::max(result.overshoot, -error * direction);
+        if (magnitude > kSettleBand) last_outside = t + 1;
+        if (t >= tail_start) tail_error += magnitude;
+        iae += magnitude;
+
+        float load = airflow / 100.0f;
+        energy_ws += kFanRatedWatts * load * load * load;
+    }
+
+    result.settle_s = static_cast<float>(last_outside);
+    result.steady_error = static_cast<float>(tail_error / (seconds - tail_start));
+    result.iae = static_cast<float>(iae);
+    result.energy_wh = static_cast<float>(energy_ws / 3600.0);
+    return result;
+}
+
+// Workers claim zones from a shared counter; each writes only its own slots
+std::vector<ZoneResult> runFleet(const GainSet& gains, uint32_t zones, int seconds,
+                                 unsigned threads, uint32_t seed) {
+    std::vector<ZoneResult> results(zones);
+    std::atomic<uint32_t> next{0};
+    auto worker = [&]() {
+        for (uint32_t z = next.fetch_add(1); z < zones; z = next.fetch_add(1)) {
+            results[z] = runZone(gains, zoneParams(seed, z), seconds, z);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned i = 1; i < threads; i++) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : pool) t.join();
+    return results;
+}
+
+float percentile(std::vector<float> values, float p) {
+    size_t index = static_cast<size_t>(p * (values.size() - 1) + 0.5f);
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+template <typename Field>
+void printDistribution(const char* label, const std::vector<ZoneResult>& results, Field field) {
+    std::vector<float> values;
+    values.reserve(results.size());
+    for (const auto& r : results) values.push_back(field(r));
+    printf("    %-18s p50 %8.2f  p90 %8.2f  p99 %8.2f  max %8.2f\n", label,
+           percentile(values, 0.50f), percentile(values, 0.90f),
+           percentile(values, 0.99f), *std::max_element(values.begin(), values.end()));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t zones = argc > 1 ? static_cast<uint32_t>(std::atoi(argv[1])) : 2000;
+    int minutes = argc > 2 ? std::atoi(argv[2]) : 60;
+    unsigned threads = argc > 3 ? static_cast<unsigned>(std::atoi(argv[3])) : 0;
+    uint32_t seed = argc > 4 ? static_cast<uint32_t>(std::atoi(argv[4])) : 1;
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    if (zones == 0 || minutes <= 0) {
+        fprintf(stderr, "usage: %s [zones] [minutes] [threads] [seed]\n", argv[0]);
+        return 2;
+    }
+    int seconds = minutes * 60;
+
+    const GainSet candidates[] = {
+        {"conservative", 4.0f, 0.1f, 1.0f},
+        {"default", 8.0f, 0.4f, 2.0f},
+        {"aggressive", 16.0f, 1.0f, 4.0f},
+    };
+
+    printf("=== Fleet Simulation: %u zones, %d min virtual time, %u threads, seed %u ===\n",
+           zones, minutes, threads, seed);
+
+    for (const GainSet& gains : candidates) {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<ZoneResult> results = runFleet(gains, zones, seconds, threads, seed);
+        double wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        uint32_t out_of_range = 0;
+        uint32_t unsettled = 0;
+        double energy_wh = 0.0;
+        for (const auto& r : results) {
+            out_of_range += r.out_of_range;
+            unsettled += r.settle_s >= seconds;
+            energy_wh += r.energy_wh;
+        }
+
+        printf("\n%s (Kp=%.1f Ki=%.2f Kd=%.1f): %.2f s wall, %.1fM zone-cycles/s\n", gains.name,
+               gains.kp, gains.ki, gains.kd, wall_s, zones * static_cast<double>(seconds) / wall_s / 1e6);
+        printDistribution("overshoot (°C)", results, [](const ZoneResult& r) { return r.overshoot; });
+        printDistribution("settle time (s)", results, [](const ZoneResult& r) { return r.settle_s; });
+        printDistribution("steady |err| (°C)", results, [](const ZoneResult& r) { return r.steady_error; });
+        printDistribution("fan energy (Wh)", results, [](const ZoneResult& r) { return r.energy_wh; });
+        printf("    fleet energy %.1f Wh, %u zones out of range, %u never settled within ±%.1f°C\n",
+               energy_wh, out_of_range, unsettled, kSettleBand);
+
+        // Worst zones by integrated error, excluding those no gains can fix
+        std::vector<uint32_t> order;
+        for (uint32_t z = 0; z < zones; z++) {
+            if (!results[z].out_of_range) order.push_back(z);
+        }
+        size_t shown = std::min<size_t>(5, order.size());
+        std::partial_sort(order.begin(), order.begin() + shown, order.end(),
+                          [&](uint32_t a, uint32_t b) { return results[a].iae > results[b].iae; });
+        printf("    worst zones:  zone   IAE(°C·s) overshoot  settle  load(W) mass(J/°C) lag(s) fan(W/°C)\n");
+        for (size_t i = 0; i < shown; i++) {
+            const ZoneResult& r = results[order[i]];
+            printf("                %6u %11.0f %9.2f %7.0f %8.1f %10.0f %6.1f %9.1f\n", order[i],
+                   r.iae, r.overshoot, r.settle_s, r.params.heat_load, r.params.thermal_mass,
+                   r.params.sensor_lag, r.params.fan_loss);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include "thermal_plant.hpp"
+#include "PIDController.hpp"
+#include "VariableFan.hpp"
+#include "LinearizedActuator.hpp"
+#include <cmath>
+#include <cstdio>
+
+// Settling time with and without fan-curve linearization.
+// The enclosure is held at 30°C while the heat load steps through low,
+// medium and high levels, which moves the fan across its dead zone and
+// the steep end of its quadratic curve. Settling time is the time until
+// the temperature stays within ±0.3°C of the setpoint after each step.
+
+struct Gains {
+    const char* name;
+    float kp;
+    float ki;
+    float kd;
+};
+
+static const float kLoads[] = {12.0f, 24.0f, 40.0f};
+static const int kPhaseSeconds = 600;
+static const float kBand = 0.3f;
+
+static void run(const Gains& gains, bool linearized, int settle[3]) {
+    ThermalPlant::Params params;
+    params.initial = 30.0f;
+    params.sensor_lag = 10.0f;
+    ThermalPlant plant(params);
+    PlantSensor sensor(plant);
+
+    VariableFan fan;
+    LinearizedActuator<VariableFan::Curve> linear_fan(fan);
+    IVariableActuator& actuator = linearized ? static_cast<IVariableActuator&>(linear_fan)
+                                             : static_cast<IVariableActuator&>(fan);
+
+    PIDController::Config config;
+    config.kp = gains.kp;
+    config.ki = gains.ki;
+    config.kd = gains.kd;
+    config.setpoint = 30.0f;
+    config.integral_max = config.output_max / gains.ki; // integral alone can reach full output
+    PIDController pid(config);
+
+    for (int phase = 0; phase < 3; phase++) {
+        plant.setHeatLoad(kLoads[phase]);
+        int last_outside = 0;
+        for (int t = 0; t < kPhaseSeconds; t++) {
+            actuator.setOutput(pid.update(sensor.readValue()));
+            plant.step(fan.getAirflow(), 1.0f);
+            if (std::fabs(plant.temperature() - config.setpoint) > kBand) {
+                last_outside = t + 1;
+            }
+        }
+        settle[phase] = last_outside;
+    }
+}
+
+int main() {
+    printf("=== Fan Linearization Simulation ===\n");
+    printf("Setpoint 30°C, sensor lag 10 s, load steps 12 W -> 24 W -> 40 W\n");
+    printf("Settling time (s) to ±%.1f°C after each load step\n\n", kBand);
+    printf("  %-22s %-11s %6s %6s %6s %7s\n", "gains", "actuator", "12 W", "24 W", "40 W", "worst");
+
+    const Gains gain_sets[] = {
+        {"conservative 3/0.1/0.5", 3.0f, 0.1f, 0.5f},
+        {"raised 8/0.4/2", 8.0f, 0.4f, 2.0f},
+    };
+
+    for (const Gains& gains : gain_sets) {
+        for (int linearized = 0; linearized < 2; linearized++) {
+            int settle[3];
+            run(gains, linearized != 0, settle);
+            int worst = settle[0];
+            for (int i = 1; i < 3; i++) worst = settle[i] > worst ? settle[i] : worst;
+            printf("  %-22s %-11s %6d %6d %6d %7d\n",
+                   gains.name, linearized ? "linearized" : "raw duty",
+                   settle[0], settle[1], settle[2], worst);
+        }
+    }
+    return 0;
+}
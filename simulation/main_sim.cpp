@@ -1,4 +1,5 @@
 #include "zephyr_sim.h"
+#include "Trace.hpp"
 #include "AdcSensor.hpp"
 #include "GpioFan.hpp"
 #include "UartLogger.hpp"
@@ -19,7 +20,7 @@ int main() {
     TemperatureController controller(sensor, fan, logger);
 
     int cycle = 0;
-    while (true) {
+    while (!TEMPCTRL_TRACE_STOP_REQUESTED()) {
         printf("[Cycle %d] ", ++cycle);
         controller.regulate();
         k_sleep(K_SECONDS(1));
@@ -0,0 +1,58 @@
+#include "NtcThermistor.hpp"
+#include <cmath>
+#include <cstdio>
+
+// Table error versus the exact thermistor equation for several table
+// sizes and temperature bands. The reference uses libm log(), so it also
+// checks the constexpr ln used to build the tables.
+
+static double betaCelsius(double r) {
+    return 1.0 / (1.0 / (Ntc10kB3950::t_nominal + ntc::kKelvinOffset) +
+                  std::log(r / Ntc10kB3950::r_nominal) / Ntc10kB3950::beta) - ntc::kKelvinOffset;
+}
+
+static double steinhartHartCelsius(double r) {
+    double l = std::log(r);
+    return 1.0 / (Ntc10kSteinhartHart::a + Ntc10kSteinhartHart::b * l +
+                  Ntc10kSteinhartHart::c * l * l * l) - ntc::kKelvinOffset;
+}
+
+template <typename Equation, std::size_t Segments>
+static void report(const char* name, double (*reference)(double)) {
+    using Table = NtcTable<Equation, ntc::LowSideDivider<Divider10k12Bit>, Segments>;
+    const double bands[][2] = {{-40.0, 125.0}, {-20.0, 100.0}, {0.0, 60.0}};
+
+    printf("%-15s %4zu %6zu ", name, Segments, sizeof(typename Table::Table));
+    for (const auto& band : bands) {
+        double worst = 0.0;
+        double sum = 0.0;
+        int count = 0;
+        for (uint32_t code = 1; code < Table::kCodes; ++code) {
+            double r = ntc::LowSideDivider<Divider10k12Bit>::resistance(code);
+            double truth = reference(r);
+            if (truth < band[0] || truth > band[1]) continue;
+            double error = std::fabs(Table::toCelsius(static_cast<uint16_t>(code)) - truth);
+            worst = std::fmax(worst, error);
+            sum += error;
+            count++;
+        }
+        printf("| %6.3f %7.4f ", worst, sum / count);
+    }
+    printf("\n");
+}
+
+int main() {
+    printf("=== NTC table error vs exact equation (°C): 10k NTC, 10k divider, 12-bit ADC ===\n");
+    printf("%-15s %4s %6s | %-14s | %-14s | %-14s\n", "", "seg", "bytes",
+           "-40..125 °C", "-20..100 °C", "0..60 °C");
+    printf("%-15s %4s %6s | %6s %7s | %6s %7s | %6s %7s\n", "equation", "", "",
+           "max", "mean", "max", "mean", "max", "mean");
+    using Beta = ntc::BetaEquation<Ntc10kB3950>;
+    using SteinhartHart = ntc::SteinhartHartEquation<Ntc10kSteinhartHart>;
+    report<Beta, 32>("Beta 3950", betaCelsius);
+    report<Beta, 64>("Beta 3950", betaCelsius);
+    report<Beta, 128>("Beta 3950", betaCelsius);
+    report<Beta, 256>("Beta 3950", betaCelsius);
+    report<SteinhartHart, 128>("Steinhart-Hart", steinhartHartCelsius);
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "zephyr_sim.h"
+#include "Trace.hpp"
 #include "AdcSensor.hpp"
 #include "VariableFan.hpp"
 #include "UartLogger.hpp"
@@ -14,10 +15,11 @@ int main() {
     // Hardware abstraction layer
     static AdcDriver adc;
     static UartDriver uart;
+    static PwmDriver pwm;
 
     // Hardware interfaces
     AdcSensor sensor(adc);
-    VariableFan fan;  // Variable speed fan using PWM simulation
+    VariableFan fan(pwm);  // Variable speed fan on the simulated PWM channel
     UartLogger logger(uart);
 
     // PID Controller configuration
@@ -38,15 +40,16 @@ int main() {
     printf("  Output range: %.0f%% - %.0f%%\n\n", pid_config.output_min, pid_config.output_max);
 
     int cycle = 0;
-    while (true) {
+    while (!TEMPCTRL_TRACE_STOP_REQUESTED()) {
         printf("[Cycle %2d] ", ++cycle);
         
         // Run temperature regulation
         controller.regulate();
         
-        // Get detailed status
-        const auto& stats = controller.getStatistics();
-        const auto& pid_state = controller.getPIDState();
+        // Get detailed status (a consistent copy, as a monitor thread would)
+        AdvancedTemperatureController::Snapshot snap = controller.snapshot();
+        const auto& stats = snap.stats;
+        const auto& pid_state = snap.pid;
         
         // Display comprehensive status every 5 cycles
         if (cycle % 5 == 0) {
@@ -89,6 +92,8 @@ int main() {
             printf("  Total cycles: %d\n", stats.total_cycles);
             printf("  Average temperature: %.2f°C\n", stats.avg_temp);
             printf("  Temperature range: %.1f°C - %.1f°C\n", stats.min_temp, stats.max_temp);
+            printf("  PWM writes: %u issued, %u suppressed\n",
+                   fan.getPwmStats().writes_issued, fan.getPwmStats().writes_suppressed);
             break;
         }
     }
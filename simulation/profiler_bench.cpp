@@ -0,0 +1,68 @@
+#include "thermal_plant.hpp"
+#include "VariableFan.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include <chrono>
+#include <cstdio>
+
+// Per-phase regulate() timing and the cost of the instrumentation itself.
+// Built with TEMPCTRL_PROFILING; the overhead loop runs the same
+// begin/mark/end sequence as regulate() with no work in between.
+
+class NullLogger : public ILogger {
+public:
+    void log(float) override {}
+};
+
+int main() {
+    const int cycles = 1000000;
+
+    // Instrumentation overhead: one full cycle of marks with empty phases
+    auto overheadNs = [cycles](uint32_t interval) {
+        CycleProfiler empty;
+        empty.setSampleInterval(interval);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < cycles; i++) {
+            empty.begin();
+            empty.mark(CycleProfiler::Sensor);
+            empty.mark(CycleProfiler::Statistics);
+            empty.mark(CycleProfiler::Pid);
+            empty.mark(CycleProfiler::Actuator);
+            empty.mark(CycleProfiler::Logging);
+            empty.end();
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / cycles;
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    volatile uint32_t sink = 0;
+    for (int i = 0; i < cycles; i++) {
+        sink = sink + CycleProfiler::now();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double timestamp_ns = std::chrono::duration<double, std::nano>(end - start).count() / cycles;
+
+    // Instrumented controller on a simulated plant
+    ThermalPlant plant;
+    PlantSensor sensor(plant, 0.05f);
+    PwmDriver pwm;
+    VariableFan fan(pwm);
+    NullLogger logger;
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+    for (int i = 0; i < cycles; i++) {
+        controller.regulate();
+        plant.step(fan.getAirflow(), 1.0f);
+    }
+
+    printf("=== regulate() Phase Profile (%d cycles, 1 in %u timed) ===\n",
+           cycles, controller.getProfiler().getSampleInterval());
+    controller.getProfiler().dump();
+
+    printf("\nInstrumentation cost (timestamp read: %.1f ns)\n", timestamp_ns);
+    const uint32_t intervals[] = {1, 4, TEMPCTRL_PROFILING_INTERVAL, 16};
+    for (uint32_t interval : intervals) {
+        printf("  1 in %-2u cycles timed: %6.1f ns/cycle\n", interval, overheadNs(interval));
+    }
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include "zephyr_sim.h"
+#include "TemperatureProcessor.hpp"
+#include "PIDController.hpp"
+#include "VariableFan.hpp"
+#include <cmath>
+
+// PWM bus traffic with and without write suppression.
+// A PID loop runs for one simulated day at 1 Hz on a slowly drifting
+// temperature read through a 12-bit ADC. Without suppression every
+// setOutput() becomes a register write; with it only duty changes do.
+
+struct Result {
+    uint32_t issued;
+    uint32_t suppressed;
+};
+
+static Result runDay(uint32_t period_cycles) {
+    PwmDriver pwm(period_cycles);
+    VariableFan fan(pwm);
+
+    PIDController::Config config;
+    config.kp = 3.0f;
+    config.ki = 0.1f;
+    config.kd = 0.5f;
+    config.setpoint = 30.0f;
+    PIDController pid(config);
+
+    uint32_t lcg = 1;
+    const int seconds = 24 * 3600;
+    for (int t = 0; t < seconds; t++) {
+        // Daily swing around the setpoint plus a little sensor noise
+        float celsius = 30.0f + 1.5f * std::sin(2.0f * 3.14159265f * t / seconds);
+        lcg = lcg * 1664525u + 1013904223u;
+        celsius += ((lcg >> 16) & 0xFF) / 255.0f * 0.2f - 0.1f;
+        uint16_t raw = static_cast<uint16_t>(celsius * 4095.0f / 330.0f);
+
+        fan.setOutput(pid.update(TemperatureProcessor::toCelsius(raw)));
+    }
+
+    return {fan.getPwmStats().writes_issued, fan.getPwmStats().writes_suppressed};
+}
+
+int main() {
+    printf("=== PWM Write Suppression Benchmark ===\n");
+    printf("24 h at 1 Hz (86400 setOutput calls per run)\n\n");
+    printf("  %-12s %10s %10s %12s\n", "resolution", "issued", "suppressed", "bus traffic");
+
+    const uint32_t resolutions[] = {100, 256, 1000, 4096, 65535};
+    for (uint32_t period : resolutions) {
+        Result r = runDay(period);
+        uint32_t total = r.issued + r.suppressed;
+        printf("  %-12u %10u %10u %11.1f%%\n",
+               period, r.issued, r.suppressed, 100.0f * r.issued / total);
+    }
+    return 0;
+}
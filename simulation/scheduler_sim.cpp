@@ -0,0 +1,172 @@
+#include "thermal_plant.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "PeriodicScheduler.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <time.h>
+
+// Drift and jitter of the absolute-deadline scheduler.
+//
+// Part 1 runs a million periods of the fastest task in virtual time, with
+// randomized execution times, wake-up latency and occasional long runs,
+// and compares where the grid ends up against the old relative loop
+// (run, then sleep one period). Part 2 runs the real controller for a few
+// seconds of wall time, sleeping with clock_nanosleep(TIMER_ABSTIME), to
+// show the host's actual wake-up jitter.
+//
+// Usage: scheduler_sim [wall-seconds]
+
+namespace {
+
+uint32_t lcg_state = 12345;
+
+uint32_t randomBelow(uint32_t bound) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return (lcg_state >> 8) % bound;
+}
+
+struct VirtualClock {
+    uint64_t now = 0;
+
+    static uint64_t read(void* context) {
+        return static_cast<VirtualClock*>(context)->now;
+    }
+};
+
+// A task that costs base + random(spread) µs, and every spike_every runs spike µs
+struct Workload {
+    VirtualClock* clock;
+    uint32_t base_us;
+    uint32_t spread_us;
+    uint32_t spike_every;
+    uint32_t spike_us;
+    uint32_t runs = 0;
+
+    static void run(void* context, uint64_t) {
+        Workload* self = static_cast<Workload*>(context);
+        self->runs++;
+        uint32_t cost = self->base_us + randomBelow(self->spread_us);
+        if (self->spike_every && self->runs % self->spike_every == 0) cost = self->spike_us;
+        self->clock->now += cost;
+    }
+};
+
+void printTask(const PeriodicScheduler& scheduler, int id) {
+    const PeriodicScheduler::TaskStats& stats = scheduler.getStats(id);
+    printf("  %-8s %8u µs %9u %8u %8u %9u %9u %9u\n", scheduler.name(id), scheduler.period(id), stats.runs,
+           stats.overruns, stats.skipped, stats.latency_us.percentile(50.0f),
+           stats.latency_us.percentile(99.0f), stats.latency_us.max());
+}
+
+void printHeader() {
+    printf("  %-8s %11s %9s %8s %8s %9s %9s %9s\n", "task", "period", "runs", "overrun", "skipped",
+           "p50 lat", "p99 lat", "max lat");
+}
+
+void virtualRun() {
+    const uint64_t periods = 1000000;
+    const uint32_t sample_us = 10000;
+    const uint64_t start = 1000;
+
+    VirtualClock clock;
+    PeriodicScheduler scheduler(&VirtualClock::read, &clock);
+    Workload sample{&clock, 80, 120, 0, 0};
+    Workload control{&clock, 1000, 2000, 5000, 12000};  // Every 5000th run takes 12 ms
+    Workload report{&clock, 2000, 3000, 0, 0};
+    int sample_id = scheduler.add("sample", sample_us, Workload::run, &sample);
+    int control_id = scheduler.add("control", 100000, Workload::run, &control, 500);
+    int report_id = scheduler.add("report", 1000000, Workload::run, &report, 5000);
+    scheduler.start(start);
+
+    // Wake-up latency: mostly tens of µs, now and then an interrupt storm
+    while (scheduler.getStats(sample_id).runs + scheduler.getStats(sample_id).skipped < periods) {
+        uint64_t wake = scheduler.nextRelease() + randomBelow(50) + (randomBelow(1000) == 0 ? 800 : 0);
+        if (wake > clock.now) clock.now = wake;
+        scheduler.runDue();
+    }
+
+    // The old loop: regulate(); k_sleep(period): every run and wake-up adds to the next period
+    lcg_state = 12345;
+    VirtualClock relative;
+    Workload relative_sample{&relative, 80, 120, 0, 0};
+    relative.now = start;
+    for (uint64_t n = 0; n < periods; n++) {
+        Workload::run(&relative_sample, 0);
+        relative.now += sample_us + randomBelow(50);
+    }
+
+    uint64_t grid_end = start + periods * sample_us;
+    int64_t drift = static_cast<int64_t>(scheduler.nextRelease(sample_id)) - static_cast<int64_t>(grid_end);
+    printf("--- %llu periods of %u µs in virtual time (%.1f h) ---\n", static_cast<unsigned long long>(periods),
+           sample_us, periods * sample_us / 3.6e9);
+    printHeader();
+    printTask(scheduler, sample_id);
+    printTask(scheduler, control_id);
+    printTask(scheduler, report_id);
+    printf("\n  Cumulative drift, absolute deadlines: %lld µs\n", static_cast<long long>(drift));
+    printf("  Cumulative drift, run-then-sleep:     %.1f s (%.2f%% slow)\n\n",
+           (relative.now - grid_end) / 1e6, 100.0 * (relative.now - grid_end) / (periods * sample_us));
+}
+
+struct Zone {
+    ThermalPlant plant;
+    PlantSensor sensor{plant, 0.05f};
+    VariableFan fan;
+    UartDriver uart;
+    UartLogger logger{uart};
+    AdvancedTemperatureController controller{sensor, fan, logger};
+
+    Zone() {
+        uart.setEcho(false);
+        controller.setDetailedTrace(false);
+    }
+
+    static void sample(void* context, uint64_t) {
+        Zone* self = static_cast<Zone*>(context);
+        self->plant.step(self->fan.getAirflow(), 0.01f);
+    }
+
+    static void control(void* context, uint64_t) {
+        static_cast<Zone*>(context)->controller.regulate(0.1f);
+    }
+};
+
+void wallRun(int seconds) {
+    Zone zone;
+    PeriodicScheduler scheduler;
+    int sample_id = scheduler.add("plant", 10000, Zone::sample, &zone);
+    int control_id = scheduler.add("control", 100000, Zone::control, &zone, 500);
+    scheduler.start();
+    uint64_t start = scheduler.nextRelease();
+
+    uint64_t end = start + static_cast<uint64_t>(seconds) * 1000000u;
+    while (scheduler.nextRelease() < end) {
+        uint64_t next = scheduler.nextRelease();
+        timespec wake = {static_cast<time_t>(next / 1000000u), static_cast<long>(next % 1000000u) * 1000};
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, nullptr);
+        scheduler.runDue();
+    }
+
+    printf("--- %d s of wall time, clock_nanosleep(TIMER_ABSTIME) ---\n", seconds);
+    printHeader();
+    printTask(scheduler, sample_id);
+    printTask(scheduler, control_id);
+    const PeriodicScheduler::TaskStats& stats = scheduler.getStats(sample_id);
+    uint64_t expected = start + static_cast<uint64_t>(stats.runs + stats.skipped) * 10000u;
+    printf("\n  Plant task grid error after %u releases: %lld µs; zone at %.2f°C\n",
+           stats.runs + stats.skipped,
+           static_cast<long long>(scheduler.nextRelease(sample_id)) - static_cast<long long>(expected),
+           zone.plant.temperature());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int seconds = argc > 1 ? atoi(argv[1]) : 3;
+    printf("=== Periodic Scheduler Simulation ===\n\n");
+    virtualRun();
+    wallRun(seconds);
+    return 0;
+}
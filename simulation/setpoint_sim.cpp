@@ -0,0 +1,217 @@
+#include "thermal_plant.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "SetpointTrajectory.hpp"
+#include "SetpointSchedule.hpp"
+#include <cmath>
+#include <cstdio>
+
+// Fan power and energy when the setpoint changes: step vs ramp vs S-curve.
+//
+// Part 1 takes the enclosure through setpoint changes of both signs with
+// pid_sim's gains (with an integral limit that reaches full output) and reports, per profile, the peak fan power, energy,
+// the largest cycle-to-cycle output change (proportional kick), time to
+// come within 0.2 °C of the new setpoint and overshoot past it. Fan
+// electrical power follows the affinity law, (airflow / 100)^3 of a 6 W
+// rated fan. Part 2 runs a day of a constexpr time-of-day schedule.
+
+namespace {
+
+const float kFanWatts = 6.0f;
+
+float fanPower(float airflow) {
+    float speed = airflow / 100.0f;
+    return kFanWatts * speed * speed * speed;
+}
+
+struct Change {
+    float at;
+    float setpoint;
+};
+
+const Change kChanges[] = {{0.0f, 28.0f}, {300.0f, 31.0f}, {900.0f, 27.0f}, {1500.0f, 29.0f}};
+const float kWindow = 600.0f;
+
+struct Metrics {
+    float peak_w = 0.0f;
+    float energy_j = 0.0f;
+    float max_kick = 0.0f;
+    float settle_s = 0.0f;
+    float overshoot = 0.0f;
+};
+
+struct Gains {
+    const char* name;
+    float kp, ki, kd;
+};
+
+const Gains kGainSets[] = {
+    {"pid_sim gains kp 3 ki 0.1 kd 0.5", 3.0f, 0.1f, 0.5f},
+    {"tight gains kp 20 ki 1 kd 30", 20.0f, 1.0f, 30.0f},
+};
+
+PIDController::Config config(const Gains& gains) {
+    PIDController::Config config;
+    config.kp = gains.kp;
+    config.ki = gains.ki;
+    config.kd = gains.kd;
+    config.setpoint = kChanges[0].setpoint;
+    config.integral_max = config.output_max / config.ki;
+    return config;
+}
+
+// Metrics per change (index 1..3), accumulated over each change's window
+void runChanges(const Gains& gains, SetpointTrajectory::Profile profile, Metrics (&out)[4]) {
+    ThermalPlant::Params params;
+    params.initial = kChanges[0].setpoint;
+    ThermalPlant plant(params);
+    PlantSensor sensor(plant, 0.05f);
+    VariableFan fan;
+    UartDriver uart;
+    uart.setEcho(false);
+    UartLogger logger(uart);
+    AdvancedTemperatureController controller(sensor, fan, logger, config(gains));
+    controller.setDetailedTrace(false);
+    controller.setSnapshotPublishing(false);
+    SetpointTrajectory::Config trajectory_config;
+    trajectory_config.profile = profile;
+    SetpointTrajectory trajectory(trajectory_config);
+    controller.setTrajectory(&trajectory);
+
+    // Start from equilibrium at the first setpoint
+    for (int i = 0; i < 600; i++) {
+        controller.regulate(1.0f);
+        plant.step(fan.getAirflow(), 1.0f);
+    }
+
+    const float dt = 1.0f;
+    float last_output = fan.getOutput();
+    int current = 0;
+    float last_outside = 0.0f;
+    for (float t = 0.0f; t < kChanges[3].at + kWindow; t += dt) {
+        for (int i = 1; i < 4; i++) {
+            if (t == kChanges[i].at) {
+                controller.setSetpoint(kChanges[i].setpoint);
+                current = i;
+                last_outside = t;
+            }
+        }
+        controller.regulate(dt);
+        plant.step(fan.getAirflow(), dt);
+        if (current == 0) continue;
+
+        Metrics& m = out[current];
+        float power = fanPower(fan.getAirflow());
+        m.peak_w = std::max(m.peak_w, power);
+        m.energy_j += power * dt;
+        m.max_kick = std::max(m.max_kick, std::fabs(fan.getOutput() - last_output));
+        last_output = fan.getOutput();
+
+        float target = kChanges[current].setpoint;
+        float from = kChanges[current - 1].setpoint;
+        float past = (plant.temperature() - target) * (target > from ? 1.0f : -1.0f);
+        m.overshoot = std::max(m.overshoot, past);
+        if (std::fabs(plant.temperature() - target) > 0.2f) last_outside = t;
+        m.settle_s = last_outside + dt - kChanges[current].at;
+    }
+}
+
+// Office hours: cooler while occupied, relaxed at night and over lunch
+constexpr SchedulePoint kWeekday[] = {
+    schedulePoint(6, 30, 27.0f),
+    schedulePoint(12, 0, 28.5f),
+    schedulePoint(13, 0, 27.0f),
+    schedulePoint(19, 0, 30.0f),
+};
+static_assert(SetpointSchedule(kWeekday).valid(), "Schedule sorted within one day");
+static_assert(SetpointSchedule(kWeekday).at(3 * 60) == 30.0f, "Night holds the evening setpoint");
+
+struct DayResult {
+    float energy_j;
+    float peak_w;
+    float rms_error;
+};
+
+DayResult runDay(const Gains& gains, SetpointTrajectory::Profile profile) {
+    const SetpointSchedule schedule(kWeekday);
+    ThermalPlant::Params params;
+    params.initial = schedule.at(0);
+    ThermalPlant plant(params);
+    PlantSensor sensor(plant, 0.05f);
+    VariableFan fan;
+    UartDriver uart;
+    uart.setEcho(false);
+    UartLogger logger(uart);
+    PIDController::Config pid_config = config(gains);
+    pid_config.setpoint = schedule.at(0);
+    AdvancedTemperatureController controller(sensor, fan, logger, pid_config);
+    controller.setDetailedTrace(false);
+    controller.setSnapshotPublishing(false);
+    SetpointTrajectory::Config trajectory_config;
+    trajectory_config.profile = profile;
+    SetpointTrajectory trajectory(trajectory_config);
+    controller.setTrajectory(&trajectory);
+
+    const float dt = 1.0f;
+    DayResult result{0.0f, 0.0f, 0.0f};
+    double sum_sq = 0.0;
+    int n = 0;
+    for (int second = 0; second < 24 * 3600; second++) {
+        // Heat load follows occupancy
+        uint16_t minute = static_cast<uint16_t>(second / 60);
+        plant.setHeatLoad(minute >= 7 * 60 && minute < 18 * 60 ? 26.0f : 20.0f);
+        float setpoint = schedule.at(minute);
+        if (second % 60 == 0 && setpoint != controller.getSetpoint()) controller.setSetpoint(setpoint);
+
+        controller.regulate(dt);
+        plant.step(fan.getAirflow(), dt);
+        float power = fanPower(fan.getAirflow());
+        result.energy_j += power * dt;
+        result.peak_w = std::max(result.peak_w, power);
+        float error = plant.temperature() - setpoint;
+        sum_sq += error * error;
+        n++;
+    }
+    result.rms_error = static_cast<float>(std::sqrt(sum_sq / n));
+    return result;
+}
+
+} // namespace
+
+int main() {
+    const SetpointTrajectory::Profile profiles[] = {SetpointTrajectory::Profile::Step,
+                                                    SetpointTrajectory::Profile::Ramp,
+                                                    SetpointTrajectory::Profile::SCurve};
+    const char* names[] = {"step", "ramp", "S-curve"};
+    SetpointTrajectory::Config defaults;
+
+    printf("=== Setpoint Trajectory Simulation ===\n\n");
+    printf("Ramp %.3f °C/s; S-curve also %.4f °C/s²; 1 s cycle\n\n", defaults.max_rate, defaults.max_accel);
+    for (const Gains& gains : kGainSets) {
+        Metrics metrics[3][4];
+        for (int p = 0; p < 3; p++) runChanges(gains, profiles[p], metrics[p]);
+        for (int c = 1; c < 4; c++) {
+            printf("--- %s, %.0f -> %.0f °C ---\n", gains.name, kChanges[c - 1].setpoint, kChanges[c].setpoint);
+            printf("  %-8s %10s %10s %12s %12s %10s\n", "profile", "peak fan", "energy", "max kick", "within 0.2",
+                   "overshoot");
+            for (int p = 0; p < 3; p++) {
+                const Metrics& m = metrics[p][c];
+                printf("  %-8s %8.2f W %8.0f J %9.1f %%/s %10.0f s %8.2f°C\n", names[p], m.peak_w, m.energy_j,
+                       m.max_kick, m.settle_s, m.overshoot);
+            }
+            printf("\n");
+        }
+
+        printf("--- %s, one day of the weekday schedule (%zu points, %zu bytes) ---\n", gains.name,
+               SetpointSchedule(kWeekday).size(), sizeof(kWeekday));
+        printf("  %-8s %10s %10s %12s\n", "profile", "energy", "peak fan", "RMS error");
+        for (int p = 0; p < 3; p++) {
+            DayResult day = runDay(gains, profiles[p]);
+            printf("  %-8s %7.1f kJ %8.2f W %10.3f°C\n", names[p], day.energy_j / 1000.0f, day.peak_w,
+                   day.rms_error);
+        }
+        printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include "thermal_plant.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "SmithPredictor.hpp"
+#include <cmath>
+#include <cstdio>
+
+// Smith predictor against a probe with transport delay.
+//
+// The zone is the default enclosure with the probe 20 s of air travel
+// away, longer than the zone's own time constant.
+// Each configuration gets a 28 -> 26 °C setpoint step and, later, a +7 W
+// heat-load step. Reported: 10-90% rise time, overshoot, time to settle
+// within 0.2 °C, mean |error| after the load step, and two stability
+// margins found by search: how far the PI gains can be scaled up, and how
+// much extra (unmodelled) delay the loop tolerates, before it no longer
+// settles.
+
+namespace {
+
+const float kDt = 1.0f;
+const float kDelay = 20.0f;
+const float kSensorLag = 1.0f;
+const float kStepAt = 60.0f;
+const float kLoadAt = 600.0f;
+const float kDuration = 1200.0f;
+const float kFrom = 28.0f;
+const float kTo = 26.0f;
+
+ThermalPlant::Params zoneParams(float delay) {
+    ThermalPlant::Params params;
+    params.initial = kFrom;
+    params.sensor_lag = kSensorLag;
+    params.transport_delay = delay;
+    return params;
+}
+
+// Linearization around the setpoint step's midpoint at the initial load
+SmithPredictor::Model zoneModel() {
+    ThermalPlant::Params p = zoneParams(kDelay);
+    float temp = 0.5f * (kFrom + kTo);
+    float loss = p.heat_load / (temp - p.ambient);
+    float airflow = (loss - p.passive_loss) / p.fan_loss * 100.0f;
+    float duty = QuadraticFanCurve::dead_zone + (100.0f - QuadraticFanCurve::dead_zone) * std::sqrt(airflow / 100.0f);
+    float slope = 2.0f * (duty - QuadraticFanCurve::dead_zone) / (95.0f * 95.0f) * 100.0f;  // d airflow / d duty
+    SmithPredictor::Model model;
+    model.gain = -p.fan_loss * (temp - p.ambient) * slope / 100.0f / loss;
+    model.time_constant = p.thermal_mass / loss;
+    model.dead_time = kDelay + kSensorLag;  // The probe lag is close to extra delay
+    return model;
+}
+
+struct Setup {
+    const char* name;
+    float kp;
+    float ki;
+    bool smith;
+    float gain_error;       // Model gain / true gain
+    float delay_error;      // Model dead time / true dead time
+};
+
+struct Result {
+    float rise_time;
+    float overshoot;
+    float settle_time;
+    float load_error;
+    bool settled;
+};
+
+Result run(const Setup& setup, float gain_scale, float extra_delay) {
+    ThermalPlant plant(zoneParams(kDelay + extra_delay));
+    PlantSensor sensor(plant);
+    VariableFan fan;
+    UartDriver uart;
+    uart.setEcho(false);
+    UartLogger logger(uart);
+
+    PIDController::Config config;
+    config.kp = setup.kp * gain_scale;
+    config.ki = setup.ki * gain_scale;
+    config.kd = 0.0f;
+    config.setpoint = kFrom;
+    config.integral_max = config.output_max / config.ki;
+    AdvancedTemperatureController controller(sensor, fan, logger, config);
+    controller.setDetailedTrace(false);
+    controller.setSnapshotPublishing(false);
+
+    SmithPredictor::Model model = zoneModel();
+    model.gain *= setup.gain_error;
+    model.dead_time *= setup.delay_error;
+    SmithPredictor predictor(model);
+    if (setup.smith) controller.setSmithPredictor(&predictor);
+
+    // Settle at the initial setpoint first
+    for (float t = 0.0f; t < 300.0f; t += kDt) {
+        controller.regulate(kDt);
+        plant.step(fan.getAirflow(), kDt);
+    }
+
+    Result result{-1.0f, 0.0f, -1.0f, 0.0f, true};
+    float t10 = -1.0f;
+    float last_outside = 0.0f;
+    double load_abs = 0.0;
+    int load_n = 0;
+    float late_min = 1e9f;
+    float late_max = -1e9f;
+    for (float t = 0.0f; t < kDuration; t += kDt) {
+        if (t == kStepAt) controller.setSetpoint(kTo);
+        if (t == kLoadAt) plant.setHeatLoad(zoneParams(0.0f).heat_load + 7.0f);
+        controller.regulate(kDt);
+        plant.step(fan.getAirflow(), kDt);
+
+        float temp = plant.temperature();
+        if (t >= kStepAt && t < kLoadAt) {
+            float progress = (kFrom - temp) / (kFrom - kTo);
+            if (t10 < 0.0f && progress >= 0.1f) t10 = t;
+            if (result.rise_time < 0.0f && progress >= 0.9f) result.rise_time = t - t10;
+            result.overshoot = std::max(result.overshoot, kTo - temp);
+            if (std::fabs(temp - kTo) > 0.2f) last_outside = t;
+        }
+        if (t >= kLoadAt) {
+            load_abs += std::fabs(temp - kTo);
+            load_n++;
+        }
+        if (t >= kDuration - 200.0f) {
+            late_min = std::min(late_min, temp);
+            late_max = std::max(late_max, temp);
+        }
+    }
+    result.settle_time = last_outside - kStepAt;
+    result.load_error = static_cast<float>(load_abs / load_n);
+    result.settled = late_max - late_min < 0.1f && std::fabs(0.5f * (late_min + late_max) - kTo) < 0.2f;
+    return result;
+}
+
+// Largest value on the grid for which the loop still settles, -1 if none
+float margin(const Setup& setup, bool gain) {
+    float best = -1.0f;
+    for (int i = 0; i <= 80; i++) {
+        float value = gain ? 1.0f + 0.1f * i : 1.0f * i;
+        Result result = gain ? run(setup, value, 0.0f) : run(setup, 1.0f, value);
+        if (!result.settled) break;
+        best = value;
+    }
+    return best;
+}
+
+} // namespace
+
+int main() {
+    SmithPredictor::Model model = zoneModel();
+    printf("=== Smith Predictor Simulation ===\n\n");
+    printf("Probe %.0f s downstream (+%.0f s sensor lag); model K %.3f °C/%%, tau %.1f s, dead time %.0f s\n\n",
+           kDelay, kSensorLag, model.gain, model.time_constant, model.dead_time);
+
+    const Setup setups[] = {
+        {"PI kp 20 ki 1 (delay-free tuning)", 20.0f, 1.0f, false, 1.0f, 1.0f},
+        {"PI kp 2.4 ki 0.18 (SIMC for delay)", 2.4f, 0.18f, false, 1.0f, 1.0f},
+        {"Smith + kp 20 ki 1", 20.0f, 1.0f, true, 1.0f, 1.0f},
+        {"Smith + kp 8 ki 0.4", 8.0f, 0.4f, true, 1.0f, 1.0f},
+        {"Smith, model gain -30%", 20.0f, 1.0f, true, 0.7f, 1.0f},
+        {"Smith, model dead time +25%", 20.0f, 1.0f, true, 1.0f, 1.25f},
+    };
+    printf("  %-36s %8s %9s %8s %9s %11s %11s\n", "controller", "rise", "overshoot", "settle", "load err",
+           "gain margin", "extra delay");
+    for (const Setup& setup : setups) {
+        Result result = run(setup, 1.0f, 0.0f);
+        float gain_margin = margin(setup, true);
+        float delay_margin = margin(setup, false);
+        char rise[16] = "-";
+        char settle[16] = "never";
+        char gain[16] = "-";
+        char delay[16] = "-";
+        if (result.rise_time >= 0.0f) snprintf(rise, sizeof(rise), "%.0f s", result.rise_time);
+        if (result.settled) snprintf(settle, sizeof(settle), "%.0f s", result.settle_time);
+        if (gain_margin > 0.0f) snprintf(gain, sizeof(gain), "x%.1f", gain_margin);
+        if (delay_margin >= 0.0f) snprintf(delay, sizeof(delay), "%.0f s", delay_margin);
+        printf("  %-36s %8s %7.2f°C %8s %7.3f°C %11s %11s\n", setup.name, rise, result.overshoot, settle,
+               result.load_error, gain, delay);
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include "thermal_plant.hpp"
+#include "VariableFan.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+// Snapshot readers under contention: N monitor threads read the controller
+// snapshot as fast as they can while the control thread regulates flat out.
+// Reports reader throughput, the share of attempts that overlapped a
+// publish, and control-loop throughput with and without readers.
+//
+// Usage: snapshot_bench [max_readers] [milliseconds]
+
+class NullLogger : public ILogger {
+public:
+    void log(float) override {}
+};
+
+struct Result {
+    double cycles_per_s;
+    double reads_per_s;
+    double retry_ratio;
+    uint32_t inconsistent;
+};
+
+static Result run(int readers, int ms) {
+    ThermalPlant plant;
+    PlantSensor sensor(plant, 0.05f);
+    PwmDriver pwm;
+    VariableFan fan(pwm);
+    NullLogger logger;
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> reads{0};
+    std::atomic<uint64_t> retries{0};
+    std::atomic<uint32_t> inconsistent{0};
+    std::vector<std::thread> threads;
+    for (int r = 0; r < readers; r++) {
+        threads.emplace_back([&]() {
+            uint64_t ok = 0;
+            uint64_t failed = 0;
+            AdvancedTemperatureController::Snapshot snap;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (!controller.trySnapshot(snap)) {
+                    // Same back-off as SeqLock::read(): let a preempted
+                    // control thread finish its publish
+                    if (++failed % 64 == 0) std::this_thread::yield();
+                    continue;
+                }
+                ok++;
+                // Invariants that only a torn copy could violate
+                if (snap.stats.cycles_active > snap.stats.total_cycles ||
+                    snap.stats.sample_count != snap.stats.total_cycles) {
+                    inconsistent.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            reads.fetch_add(ok);
+            retries.fetch_add(failed);
+        });
+    }
+
+    uint64_t cycles = 0;
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = start + std::chrono::milliseconds(ms);
+    while (std::chrono::steady_clock::now() < deadline) {
+        for (int i = 0; i < 256; i++) {
+            controller.regulate(0.1f);
+            plant.step(fan.getAirflow(), 0.1f);
+        }
+        cycles += 256;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    stop = true;
+    for (auto& t : threads) t.join();
+
+    uint64_t attempts = reads.load() + retries.load();
+    return Result{cycles / seconds, reads.load() / seconds,
+                  attempts ? static_cast<double>(retries.load()) / attempts : 0.0,
+                  inconsistent.load()};
+}
+
+int main(int argc, char** argv) {
+    int max_readers = argc > 1 ? std::atoi(argv[1]) : 4;
+    int ms = argc > 2 ? std::atoi(argv[2]) : 500;
+
+    printf("=== Snapshot readers under contention (%d ms per run, %u hardware threads) ===\n",
+           ms, std::thread::hardware_concurrency());
+    printf("%7s %14s %14s %10s %12s\n", "readers", "cycles/s", "reads/s", "retries", "inconsistent");
+    for (int readers = 0; readers <= max_readers; readers = readers ? readers * 2 : 1) {
+        Result r = run(readers, ms);
+        printf("%7d %14.0f %14.0f %9.3f%% %12u\n", readers, r.cycles_per_s, r.reads_per_s,
+               r.retry_ratio * 100.0, r.inconsistent);
+    }
+    return 0;
+}
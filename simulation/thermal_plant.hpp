@@ -0,0 +1,103 @@
+#pragma once
+
+/**
+ * @file thermal_plant.hpp
+ * @brief Lumped thermal model of a fan-cooled enclosure for closed-loop simulation
+ *
+ *   C * dT/dt = P_heat - (h_passive + h_fan * airflow / 100) * (T - T_ambient)
+ *
+ * The sensor sees T through a first-order lag (probe mounting, housing)
+ * and, for probes far from the heat source, a pure transport delay.
+ * Integrated with a fixed internal step so callers can advance by any dt.
+ */
+
+#include "ISensor.hpp"
+#include "TemperatureProcessor.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+class ThermalPlant {
+public:
+    struct Params {
+        float ambient = 22.0f;        // Ambient temperature (°C)
+        float heat_load = 23.0f;      // Heat input (W)
+        float thermal_mass = 60.0f;   // Heat capacity (J/°C)
+        float passive_loss = 1.0f;    // Conduction without airflow (W/°C)
+        float fan_loss = 9.0f;        // Extra loss at 100% airflow (W/°C)
+        float initial = 35.0f;        // Starting temperature (°C)
+        float sensor_lag = 0.0f;      // Sensor time constant (s), 0 = ideal probe
+        float transport_delay = 0.0f; // Air travel time to the probe (s)
+    };
+
+    ThermalPlant() : ThermalPlant(Params{}) {}
+    explicit ThermalPlant(const Params& params)
+        : params_(params), temperature_(params.initial), sensed_(params.initial),
+          delay_line_(static_cast<size_t>(params.transport_delay / kStep + 0.5f), params.initial) {}
+
+    /**
+     * @brief Advance the model
+     * @param airflow Fan airflow percentage (0-100)
+     * @param dt Time step in seconds
+     */
+    void step(float airflow, float dt) {
+        while (dt > 0.0f) {
+            float h = std::min(dt, kStep);
+            float loss = params_.passive_loss + params_.fan_loss * airflow / 100.0f;
+            float dT = (params_.heat_load - loss * (temperature_ - params_.ambient)) / params_.thermal_mass;
+            temperature_ += dT * h;
+            if (params_.sensor_lag > 0.0f) {
+                sensed_ += (temperature_ - sensed_) * std::min(1.0f, h / params_.sensor_lag);
+            } else {
+                sensed_ = temperature_;
+            }
+            if (!delay_line_.empty()) {
+                delay_line_[delay_index_] = sensed_;
+                delay_index_ = (delay_index_ + 1) % delay_line_.size();
+            }
+            dt -= h;
+        }
+    }
+
+    float temperature() const { return temperature_; }
+    float sensedTemperature() const { return delay_line_.empty() ? sensed_ : delay_line_[delay_index_]; }
+    void setHeatLoad(float watts) { params_.heat_load = watts; }
+    void setAmbient(float celsius) { params_.ambient = celsius; }
+    void setFanLoss(float watts_per_degree) { params_.fan_loss = watts_per_degree; }
+    const Params& params() const { return params_; }
+
+private:
+    static constexpr float kStep = 0.05f;
+
+    Params params_;
+    float temperature_;
+    float sensed_;
+    std::vector<float> delay_line_;   // Lagged readings, one per internal step
+    size_t delay_index_ = 0;          // Oldest entry, overwritten next
+};
+
+/**
+ * @brief ISensor view of a ThermalPlant through a 12-bit ADC
+ *
+ * Applies the same quantization as TemperatureProcessor::toCelsius() and
+ * optional uniform noise so control loops see realistic readings.
+ */
+class PlantSensor : public ISensor {
+public:
+    explicit PlantSensor(const ThermalPlant& plant, float noise_amplitude = 0.0f, uint32_t seed = 1)
+        : plant_(plant), noise_(noise_amplitude), lcg_(seed) {}
+
+    float readValue() override {
+        lcg_ = lcg_ * 1664525u + 1013904223u;
+        float noise = noise_ * (((lcg_ >> 8) & 0xFFFF) / 32767.5f - 1.0f);
+        float celsius = plant_.sensedTemperature() + noise;
+        int raw = static_cast<int>(celsius * 4095.0f / 330.0f + 0.5f);
+        raw = std::max(0, std::min(4095, raw));
+        return TemperatureProcessor::toCelsius(static_cast<uint16_t>(raw));
+    }
+
+private:
+    const ThermalPlant& plant_;
+    float noise_;
+    uint32_t lcg_;
+};
@@ -0,0 +1,69 @@
+#include "zephyr_sim.h"
+#include "thermal_plant.hpp"
+#include "AdcSensor.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+// Many controllers on their own threads, recorded as a Chrome trace.
+// Each thread runs a 10 ms real-time loop against its own plant; open the
+// resulting trace.json in ui.perfetto.dev or chrome://tracing to inspect
+// per-phase timing, sleep jitter and overlap between controllers.
+//
+// Usage: trace_sim [controllers] [seconds]
+
+class PlantSensorTraced : public PlantSensor {
+public:
+    using PlantSensor::PlantSensor;
+    float readValue() override {
+        TEMPCTRL_TRACE_SCOPE("sensor_read");
+        return PlantSensor::readValue();
+    }
+};
+
+static void runZone(int zone, int period_ms, std::atomic<bool>& stop) {
+    ThermalPlant::Params params;
+    params.heat_load = 15.0f + zone % 5 * 5.0f;
+    ThermalPlant plant(params);
+    PlantSensorTraced sensor(plant, 0.05f, zone + 1);
+    PwmDriver pwm;
+    VariableFan fan(pwm);
+    UartDriver uart;
+    uart.setEcho(false);
+    UartLogger logger(uart);
+
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+
+    while (!stop.load(std::memory_order_relaxed)) {
+        controller.regulate(period_ms / 1000.0f);
+        plant.step(fan.getAirflow(), period_ms / 1000.0f);
+        TEMPCTRL_TRACE_SCOPE("sleep");
+        k_sleep(K_MSEC(period_ms));
+    }
+}
+
+int main(int argc, char** argv) {
+    int controllers = argc > 1 ? std::atoi(argv[1]) : 8;
+    int seconds = argc > 2 ? std::atoi(argv[2]) : 2;
+    const int period_ms = 10;
+
+    printf("=== Trace Simulation: %d controllers, %d s, %d ms period ===\n",
+           controllers, seconds, period_ms);
+
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> threads;
+    for (int zone = 0; zone < controllers; zone++) {
+        threads.emplace_back(runZone, zone, period_ms, std::ref(stop));
+    }
+    k_sleep(K_SECONDS(seconds));
+    stop = true;
+    for (auto& t : threads) t.join();
+
+    // Trace is flushed to $TEMPCTRL_TRACE_FILE (default trace.json) at exit
+    return 0;
+}
@@ -0,0 +1,241 @@
+#include "thermal_plant.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "ByteRing.hpp"
+#include "CommandProtocol.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// The command protocol over a pseudo-terminal standing in for the serial
+// link. The "device" owns the pty master: a reader thread plays the RX
+// interrupt (pushing into the ByteRing) and replies go out through the
+// UART driver's binary sink. The control loop polls the CommandServer
+// every millisecond and regulates a simulated zone every 100 ms.
+//
+// Usage: uart_command_sim            built-in client on the slave side
+//        uart_command_sim --serve N  print the slave path and serve for N s
+//                                    (connect any serial tool at 8N1 raw)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+void makeRaw(int fd) {
+    termios tio;
+    tcgetattr(fd, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(fd, TCSANOW, &tio);
+}
+
+std::vector<uint8_t> request(uint8_t command, uint8_t sequence, const std::vector<uint8_t>& payload = {}) {
+    std::vector<uint8_t> bytes = {protocol::kStartOfFrame, static_cast<uint8_t>(payload.size()), command, sequence};
+    bytes.insert(bytes.end(), payload.begin(), payload.end());
+    uint16_t crc = crc::crc16(bytes.data() + 1, bytes.size() - 1);
+    bytes.push_back(static_cast<uint8_t>(crc));
+    bytes.push_back(static_cast<uint8_t>(crc >> 8));
+    return bytes;
+}
+
+std::vector<uint8_t> floats(std::initializer_list<float> values) {
+    std::vector<uint8_t> bytes;
+    for (float value : values) {
+        uint8_t raw[4];
+        memcpy(raw, &value, sizeof(raw));
+        bytes.insert(bytes.end(), raw, raw + 4);
+    }
+    return bytes;
+}
+
+float f32At(const std::vector<uint8_t>& bytes, size_t offset) {
+    float value;
+    memcpy(&value, bytes.data() + offset, sizeof(value));
+    return value;
+}
+
+uint32_t u32At(const std::vector<uint8_t>& bytes, size_t offset) {
+    uint32_t value;
+    memcpy(&value, bytes.data() + offset, sizeof(value));
+    return value;
+}
+
+// Read one reply frame from @p fd; empty on timeout or a bad frame
+std::vector<uint8_t> readReply(int fd, int timeout_ms) {
+    std::vector<uint8_t> bytes;
+    size_t wanted = protocol::kHeaderSize;
+    while (bytes.size() < wanted) {
+        pollfd pfd = {fd, POLLIN, 0};
+        if (::poll(&pfd, 1, timeout_ms) <= 0) return {};
+        uint8_t buffer[protocol::kMaxFrame];
+        ssize_t got = read(fd, buffer, wanted - bytes.size());
+        if (got <= 0) return {};
+        bytes.insert(bytes.end(), buffer, buffer + got);
+        if (bytes[0] != protocol::kStartOfFrame) bytes.erase(bytes.begin());
+        if (bytes.size() >= 2) wanted = protocol::kHeaderSize + bytes[1] + protocol::kCrcSize;
+    }
+    uint16_t crc = crc::crc16(bytes.data() + 1, bytes.size() - 3);
+    if ((bytes[bytes.size() - 2] | bytes[bytes.size() - 1] << 8) != crc) return {};
+    return std::vector<uint8_t>(bytes.begin() + protocol::kHeaderSize, bytes.end() - protocol::kCrcSize);
+}
+
+const char* statusName(uint8_t status) {
+    switch (status) {
+        case protocol::Ok: return "ok";
+        case protocol::UnknownCommand: return "unknown command";
+        case protocol::BadLength: return "bad length";
+        case protocol::BadValue: return "bad value";
+        default: return "?";
+    }
+}
+
+// Host side: a few commands, including a corrupted frame, against the device
+void runClient(const char* path) {
+    int fd = open(path, O_RDWR | O_NOCTTY);
+    if (fd < 0) {
+        perror("open slave");
+        return;
+    }
+    makeRaw(fd);
+
+    uint8_t sequence = 0;
+    auto transact = [&](const char* label, const std::vector<uint8_t>& frame) {
+        auto start = Clock::now();
+        if (write(fd, frame.data(), frame.size()) != static_cast<ssize_t>(frame.size())) return std::vector<uint8_t>{};
+        std::vector<uint8_t> reply = readReply(fd, 500);
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        if (reply.empty()) {
+            printf("  %-28s no reply\n", label);
+        } else {
+            printf("  %-28s %-16s %6.2f ms round trip\n", label, statusName(reply[0]), ms);
+        }
+        return reply;
+    };
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    std::vector<uint8_t> stats = transact("READ_STATS", request(protocol::ReadStats, sequence++));
+    if (stats.size() == 33) {
+        printf("    cycles %u, last %.2f°C, output %.1f%%, setpoint %.1f°C\n", u32At(stats, 1),
+               f32At(stats, 9), f32At(stats, 25), f32At(stats, 29));
+    }
+    transact("SET_SETPOINT 28.0", request(protocol::SetSetpoint, sequence++, floats({28.0f})));
+    transact("SET_SETPOINT 900 (refused)", request(protocol::SetSetpoint, sequence++, floats({900.0f})));
+    transact("SET_GAINS 6 / 0.3 / 1.5", request(protocol::SetGains, sequence++, floats({6.0f, 0.3f, 1.5f})));
+
+    // Line noise and a frame with a flipped bit: no reply, parser resynchronises
+    std::vector<uint8_t> noise = {0x13, 0xA5, 0xF0, 0x00};
+    std::vector<uint8_t> corrupt = request(protocol::ReadStats, sequence++);
+    corrupt[3] ^= 0x01;
+    noise.insert(noise.end(), corrupt.begin(), corrupt.end());
+    transact("noise + corrupt frame", noise);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    std::vector<uint8_t> history = transact("READ_HISTORY 8", request(protocol::ReadHistory, sequence++, {8}));
+    if (history.size() >= 2) {
+        printf("    ");
+        for (size_t i = 0; i < history[1]; i++) {
+            int16_t centi = static_cast<int16_t>(history[2 + 2 * i] | history[3 + 2 * i] << 8);
+            printf("%.2f ", centi / 100.0f);
+        }
+        printf("°C\n");
+    }
+    stats = transact("READ_STATS", request(protocol::ReadStats, sequence++));
+    if (stats.size() == 33) {
+        printf("    cycles %u, last %.2f°C, output %.1f%%, setpoint %.1f°C\n", u32At(stats, 1),
+               f32At(stats, 9), f32At(stats, 25), f32At(stats, 29));
+    }
+    close(fd);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int serve_seconds = 0;
+    if (argc > 2 && strcmp(argv[1], "--serve") == 0) serve_seconds = atoi(argv[2]);
+
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        perror("posix_openpt");
+        return 1;
+    }
+    const char* slave_path = ptsname(master);
+    makeRaw(master);
+    printf("=== UART Command Protocol Simulation (pty %s) ===\n\n", slave_path);
+
+    // Device side
+    ThermalPlant::Params params;
+    params.heat_load = 40.0f;
+    params.initial = 35.0f;
+    ThermalPlant plant(params);
+    PlantSensor sensor(plant, 0.05f);
+    VariableFan fan;
+    UartDriver log_uart;
+    log_uart.setEcho(false);
+    UartLogger logger(log_uart);
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+
+    UartDriver uart;
+    FILE* tx = fdopen(dup(master), "wb");
+    uart.setBinarySink(tx);
+    StaticByteRing<512> rx;
+    CommandServer server(rx, uart, controller);
+
+    std::atomic<bool> running{true};
+    std::thread rx_thread([&] {
+        uint8_t buffer[64];
+        while (running.load(std::memory_order_relaxed)) {
+            pollfd pfd = {master, POLLIN, 0};
+            if (::poll(&pfd, 1, 20) <= 0) continue;
+            ssize_t got = read(master, buffer, sizeof(buffer));
+            // EIO once the slave side is closed; keep waiting for the next client
+            if (got > 0) rx.push(buffer, static_cast<size_t>(got));
+        }
+    });
+
+    std::thread client;
+    if (serve_seconds > 0) {
+        printf("  Serving %d s; connect to %s\n", serve_seconds, slave_path);
+    } else {
+        // The built-in client keeps the slave open for the whole demo
+        client = std::thread(runClient, slave_path);
+    }
+
+    auto start = Clock::now();
+    auto next_cycle = start;
+    auto deadline = start + std::chrono::seconds(serve_seconds > 0 ? serve_seconds : 5);
+    while (Clock::now() < deadline) {
+        auto now = Clock::now();
+        uint32_t now_ms = static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count());
+        server.poll(now_ms);
+        if (now >= next_cycle) {
+            controller.regulate(1.0f);      // 10x real time: 1 s of plant per 100 ms
+            plant.step(fan.getAirflow(), 1.0f);
+            server.recordSample(plant.sensedTemperature());
+            next_cycle += std::chrono::milliseconds(100);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    if (client.joinable()) client.join();
+    running = false;
+    rx_thread.join();
+    fclose(tx);
+    close(master);
+
+    const CommandServer::Stats& stats = server.getStats();
+    printf("\n  Server: %u frames, %u CRC errors, %u length errors, %u timeouts, %u bytes discarded\n",
+           stats.frames, stats.crc_errors, stats.length_errors, stats.timeouts, stats.discarded_bytes);
+    printf("  Worst poll examined %zu bytes (budget %zu), ring overflows %u\n", stats.max_examined,
+           CommandServer::kScanBudget, rx.overflows());
+    return 0;
+}
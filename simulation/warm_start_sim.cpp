@@ -0,0 +1,109 @@
+#include "thermal_plant.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "WarmStartStore.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+// Recovery after a reboot with and without warm start. A heavily loaded
+// zone runs for two hours (saving through the file-backed settings
+// driver), then the controller resets: the fan stops for the boot time
+// while the enclosure keeps heating. Cold start begins again from a zero
+// integral; warm start resumes the saved one.
+//
+// Usage: warm_start_sim [settings-directory]
+
+namespace {
+
+const float kSetpoint = 30.0f;
+const float kSettleBand = 0.5f;
+const int kBootSeconds = 5;
+
+PIDController::Config zoneConfig() {
+    PIDController::Config config;
+    config.kp = 8.0f;
+    config.ki = 0.4f;
+    config.kd = 2.0f;
+    config.setpoint = kSetpoint;
+    config.integral_max = config.output_max / config.ki;
+    return config;
+}
+
+ThermalPlant::Params zoneParams() {
+    ThermalPlant::Params params;
+    params.heat_load = 60.0f;       // Needs ~70% airflow at the setpoint
+    params.thermal_mass = 60.0f;
+    params.sensor_lag = 10.0f;
+    params.initial = kSetpoint;
+    return params;
+}
+
+struct Recovery {
+    int settle_s;
+    float peak_error;
+};
+
+// One controller lifetime: @p seconds of 1 Hz regulation from the plant's current state
+Recovery run(ThermalPlant& plant, WarmStartStore* store, int seconds, bool* restored = nullptr) {
+    PlantSensor sensor(plant, 0.05f);
+    VariableFan fan;
+    UartDriver uart;
+    uart.setEcho(false);
+    UartLogger logger(uart);
+    AdvancedTemperatureController controller(sensor, fan, logger, zoneConfig());
+    controller.setDetailedTrace(false);
+    if (store) {
+        bool ok = controller.enableWarmStart(*store);
+        if (restored) *restored = ok;
+    }
+
+    Recovery result{0, 0.0f};
+    for (int t = 0; t < seconds; t++) {
+        controller.regulate(1.0f);
+        plant.step(fan.getAirflow(), 1.0f);
+        float error = std::fabs(plant.temperature() - kSetpoint);
+        result.peak_error = std::max(result.peak_error, error);
+        if (error > kSettleBand) result.settle_s = t + 1;
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* directory = argc > 1 ? argv[1] : ".";
+    printf("=== Warm-Start Recovery Simulation (settings in %s) ===\n\n", directory);
+
+    SettingsDriver settings(directory);
+    WarmStartStore store(settings);
+
+    // Converge for two hours while the store coalesces saves
+    ThermalPlant plant(zoneParams());
+    const int converge_s = 2 * 3600;
+    run(plant, &store, converge_s);
+    printf("  Saves over %d h: %u (per-cycle saving would be %d), %u bytes written\n",
+           converge_s / 3600, settings.getWriteCount(), converge_s,
+           static_cast<unsigned>(settings.getBytesWritten()));
+
+    // Reboot: fan off while the firmware starts
+    plant.step(0.0f, static_cast<float>(kBootSeconds));
+    printf("  Reboot: fan off for %d s, enclosure at %.2f°C\n\n", kBootSeconds, plant.temperature());
+
+    const int recover_s = 1800;
+    ThermalPlant cold_plant = plant;
+    Recovery cold = run(cold_plant, nullptr, recover_s);
+
+    ThermalPlant warm_plant = plant;
+    SettingsDriver reboot_settings(directory);
+    WarmStartStore reboot_store(reboot_settings);
+    bool restored = false;
+    Recovery warm = run(warm_plant, &reboot_store, recover_s, &restored);
+
+    printf("  %-12s %18s %16s\n", "start", "settle (±0.5°C)", "peak |error|");
+    printf("  %-12s %16d s %14.2f°C\n", "cold", cold.settle_s, cold.peak_error);
+    printf("  %-12s %16d s %14.2f°C%s\n", "warm", warm.settle_s, warm.peak_error,
+           restored ? "" : "  (no valid record: cold)");
+    return 0;
+}
@@ -6,6 +6,7 @@
 
 // Simulate Zephyr's k_sleep function
 #define K_SECONDS(s) (s * 1000)
+#define K_MSEC(ms) (ms)
 inline void k_sleep(int ms) {
     std::this_thread::sleep_for(std::chrono::milliseconds(ms));
 }
@@ -12,15 +12,35 @@
 #include "IVariableActuator.hpp"
 #include "ILogger.hpp"
 #include "PIDController.hpp"
+#include "TemperatureEstimator.hpp"
+#include "PlantIdentifier.hpp"
+#include "SmithPredictor.hpp"
+#include "SetpointTrajectory.hpp"
+#include "CycleProfiler.hpp"
+#include "SeqLock.hpp"
+#include "WarmStartStore.hpp"
+#include "Trace.hpp"
+#include <cstdio>
 
 class AdvancedTemperatureController {
-private:
-    ISensor& sensor_;
-    IVariableActuator& actuator_;
-    ILogger& logger_;
-    PIDController pid_;
-    
-    // Statistics and monitoring
+public:
+    /**
+     * @brief Send-on-delta (event-driven) regulation settings
+     *
+     * When enabled, the sensor is still sampled every cycle but the PID,
+     * actuator and logging work only runs when the reading has moved by at
+     * least @c deadband since the last processed cycle, or when
+     * @c max_silent_cycles cycles have passed without processing.
+     */
+    struct EventConfig {
+        bool enabled = false;
+        float deadband = 0.2f;            // Change (°C) that triggers processing
+        uint32_t max_silent_cycles = 60;  // Forced processing interval (cycles)
+    };
+
+    /**
+     * @brief Temperature statistics and cycle counters
+     */
     struct Statistics {
         float min_temp = 999.0f;
         float max_temp = -999.0f;
@@ -29,7 +49,53 @@ private:
         float temp_sum = 0.0f;
         uint32_t cycles_active = 0;
         uint32_t total_cycles = 0;
-    } stats_;
+        uint32_t skipped_cycles = 0;   // Cycles held by send-on-delta mode
+        float last_temp = 0.0f;        // Most recent reading
+        uint32_t gain_adaptations = 0; // Gain sets applied from the plant identifier
+    };
+
+    /**
+     * @brief Consistent copy of the control state for monitoring threads
+     */
+    struct Snapshot {
+        PIDController::State pid;
+        Statistics stats;
+        float setpoint = 0.0f;
+    };
+
+private:
+    ISensor& sensor_;
+    IVariableActuator& actuator_;
+    ILogger& logger_;
+    PIDController pid_;
+
+    // Setpoint/gain changes from other threads, applied at cycle boundaries
+    SeqLock<PIDController::Config> config_channel_;
+    uint32_t applied_config_version_;
+    
+    // Statistics and monitoring; snapshot_ is the copy other threads read
+    Statistics stats_;
+    SeqLock<Snapshot> snapshot_;
+
+    EventConfig event_config_;
+    float last_processed_temp_ = 0.0f;
+    float last_processed_setpoint_ = 0.0f;
+    uint32_t processed_config_version_ = 0;
+    uint32_t silent_cycles_ = 0;
+    bool has_processed_ = false;
+    bool detailed_trace_ = true;
+    bool publish_snapshots_ = true;
+    WarmStartStore* warm_start_ = nullptr;
+    TemperatureEstimator* estimator_ = nullptr;
+    PlantIdentifier* identifier_ = nullptr;
+    SmithPredictor* smith_ = nullptr;
+    SetpointTrajectory* trajectory_ = nullptr;
+    uint32_t adapt_interval_ = 0;
+    uint32_t adapt_countdown_ = 0;
+
+#ifdef TEMPCTRL_PROFILING
+    CycleProfiler profiler_;
+#endif
 
 public:
     /**
@@ -43,23 +109,82 @@ public:
                                 IVariableActuator& actuator,
                                 ILogger& logger,
                                 const PIDController::Config& pid_config = PIDController::Config{})
-        : sensor_(sensor), actuator_(actuator), logger_(logger), pid_(pid_config) {}
+        : sensor_(sensor), actuator_(actuator), logger_(logger), pid_(pid_config),
+          config_channel_(pid_config), applied_config_version_(config_channel_.version()) {}
 
     /**
      * @brief Main regulation cycle - call this periodically
      */
     void regulate() {
+        regulate(1.0f);
+    }
+
+    /**
+     * @brief Regulation cycle with a variable period
+     * @param dt Time since the previous cycle in seconds; PID gains are
+     *           defined per second, so 1.0 matches regulate()
+     */
+    void regulate(float dt) {
+        TEMPCTRL_TRACE_SCOPE("regulate");
+        TEMPCTRL_PROFILE_BEGIN(profiler_);
+        applyPendingConfig();
+        if (trajectory_) {
+            pid_.setSetpoint(trajectory_->update(dt));
+        }
+
         // Read current temperature
         float current_temp = sensor_.readValue();
+        TEMPCTRL_PROFILE_MARK(profiler_, Sensor);
         
-        // Update statistics
+        // Update statistics (raw readings)
         updateStatistics(current_temp);
+        if (identifier_) identifyPlant(current_temp, dt);
+
+        // Control on the estimate; the fan output predicted is the one held since the last cycle
+        if (estimator_) {
+            estimator_->updateWithAirflow(current_temp, dt, actuator_.getAirflow());
+            current_temp = estimator_->temperature();
+        }
+        // Dead-time compensation: add the response still on its way to the probe
+        if (smith_) {
+            current_temp = smith_->update(current_temp, actuator_.getOutput(), dt);
+        }
+        TEMPCTRL_PROFILE_MARK(profiler_, Statistics);
+
+        // Send-on-delta: hold the output while the reading is flat
+        if (shouldHold(current_temp)) {
+            pid_.hold(current_temp, dt);
+            silent_cycles_++;
+            stats_.skipped_cycles++;
+            stats_.total_cycles++;
+            if (actuator_.isActive()) {
+                stats_.cycles_active++;
+            }
+            publishSnapshot();
+            persistWarmStart(dt);
+            TEMPCTRL_PROFILE_MARK(profiler_, Pid);
+            TEMPCTRL_PROFILE_END(profiler_);
+            return;
+        }
+        last_processed_temp_ = current_temp;
+        last_processed_setpoint_ = pid_.getSetpoint();
+        processed_config_version_ = applied_config_version_;
+        silent_cycles_ = 0;
+        has_processed_ = true;
         
         // Run PID controller
-        float control_output = pid_.update(current_temp);
+        float control_output;
+        {
+            TEMPCTRL_TRACE_SCOPE("pid_update");
+            // The estimator's slope is of the delayed reading; with a predictor, difference its output
+            control_output = estimator_ && !smith_ ? pid_.updateWithRate(current_temp, estimator_->rate(), dt)
+                                                   : pid_.update(current_temp, dt);
+        }
+        TEMPCTRL_PROFILE_MARK(profiler_, Pid);
         
         // Apply control output to actuator
         actuator_.setOutput(control_output);
+        TEMPCTRL_PROFILE_MARK(profiler_, Actuator);
         
         // Enhanced logging with PID data
         logDetailedStatus(current_temp, control_output);
@@ -68,32 +193,87 @@ public:
         if (actuator_.isActive()) {
             stats_.cycles_active++;
         }
+        publishSnapshot();
+        persistWarmStart(dt);
+        TEMPCTRL_PROFILE_MARK(profiler_, Logging);
+        TEMPCTRL_PROFILE_END(profiler_);
     }
 
     /**
      * @brief Set new target temperature
+     *
+     * Safe to call from any thread; takes effect at the next regulate().
      * @param setpoint Target temperature in Celsius
      */
     void setSetpoint(float setpoint) {
-        pid_.setSetpoint(setpoint);
+        config_channel_.update([setpoint](PIDController::Config& config) {
+            config.setpoint = setpoint;
+        });
     }
 
     /**
-     * @brief Get current target temperature
+     * @brief Get the most recently published target temperature
      * @return Current setpoint in Celsius
      */
     float getSetpoint() const {
-        return pid_.getSetpoint();
+        return config_channel_.read().setpoint;
     }
 
     /**
      * @brief Update PID tuning parameters
+     *
+     * Safe to call from any thread; the three gains are published together
+     * and take effect at the next regulate().
      * @param kp Proportional gain
      * @param ki Integral gain
      * @param kd Derivative gain
      */
     void tunePID(float kp, float ki, float kd) {
-        pid_.setGains(kp, ki, kd);
+        config_channel_.update([kp, ki, kd](PIDController::Config& config) {
+            config.kp = kp;
+            config.ki = ki;
+            config.kd = kd;
+        });
+    }
+
+    /**
+     * @brief Publish a complete PID configuration from any thread
+     * @param config Gains, setpoint and limits, applied together at the next regulate()
+     */
+    void publishConfig(const PIDController::Config& config) {
+        config_channel_.write(config);
+    }
+
+    /**
+     * @brief Get the configuration the control loop is currently using
+     * @return Active PID configuration (control-loop thread only)
+     */
+    const PIDController::Config& getActiveConfig() const {
+        return pid_.getConfig();
+    }
+
+    /**
+     * @brief Configure send-on-delta (event-driven) regulation
+     * @param config Deadband and forced-update interval
+     */
+    void setEventMode(const EventConfig& config) {
+        event_config_ = config;
+    }
+
+    /**
+     * @brief Get send-on-delta settings
+     * @return Current event configuration
+     */
+    const EventConfig& getEventMode() const {
+        return event_config_;
+    }
+
+    /**
+     * @brief Enable or disable the per-cycle printf trace line
+     * @param enabled true to print PID details every processed cycle
+     */
+    void setDetailedTrace(bool enabled) {
+        detailed_trace_ = enabled;
     }
 
     /**
@@ -102,6 +282,9 @@ public:
     void reset() {
         pid_.reset();
         stats_ = Statistics{};
+        silent_cycles_ = 0;
+        has_processed_ = false;
+        publishSnapshot();
     }
 
     /**
@@ -114,12 +297,146 @@ public:
 
     /**
      * @brief Get controller statistics
-     * @return Current statistics
+     * @return Current statistics (control-loop thread only; see snapshot())
      */
     const Statistics& getStatistics() const {
         return stats_;
     }
 
+    /**
+     * @brief Consistent copy of PID state and statistics from any thread
+     *
+     * Published at the end of every regulate(); retries only while the
+     * control thread is mid-publish, and never delays it.
+     * @return State as of the last completed cycle
+     */
+    Snapshot snapshot() const {
+        return snapshot_.read();
+    }
+
+    /**
+     * @brief Enable or disable per-cycle snapshot publication
+     *
+     * On by default. Loops without monitor threads can turn it off to save
+     * the ~20 word stores per cycle; snapshot() then returns the state as
+     * of the last published cycle.
+     * @param enabled true to publish at the end of every regulate()
+     */
+    void setSnapshotPublishing(bool enabled) {
+        publish_snapshots_ = enabled;
+    }
+
+    /**
+     * @brief Persist configuration and integral through @p store, and
+     *        resume from its last valid record
+     *
+     * Call once at startup, before the first regulate(). The restored
+     * configuration replaces the constructor's; without a valid record the
+     * controller cold-starts and the store saves the current one.
+     * @param store Settings-backed store; must outlive the controller
+     * @return true if a saved record was restored
+     */
+    bool enableWarmStart(WarmStartStore& store) {
+        warm_start_ = &store;
+        PIDController::Config config;
+        float integral = 0.0f;
+        float output = 0.0f;
+        if (!store.load(config, integral, output)) return false;
+        publishConfig(config);
+        applyPendingConfig();
+        pid_.warmStart(integral, output);
+        publishSnapshot();
+        return true;
+    }
+
+    /**
+     * @brief Control on a Kalman estimate instead of raw readings
+     *
+     * Each cycle the reading and the airflow of the previous interval go
+     * through @p estimator; the PID then sees the filtered temperature and
+     * takes its derivative from the estimated slope. Statistics keep the
+     * raw readings. Pass nullptr to go back to raw control.
+     *
+     * The airflow is the actuator's getAirflow(), not its output: a
+     * VariableFan reports its duty through its fan curve, while a
+     * LinearizedActuator or FanBank already commands airflow and reports
+     * what its fans deliver. The estimator's Config::airflow is therefore
+     * not used here and needs no change when the actuator is linearized.
+     * @param estimator Estimator tuned for this zone; must outlive the controller
+     */
+    void setEstimator(TemperatureEstimator* estimator) {
+        estimator_ = estimator;
+    }
+
+    /**
+     * @brief Move the setpoint along a profile instead of stepping it
+     *
+     * Setpoints published with setSetpoint() or publishConfig() become the
+     * trajectory's target; each cycle the PID regulates to the profile's
+     * current value (reported as the snapshot's setpoint). The trajectory
+     * starts at the active setpoint. Pass nullptr to step again.
+     * @param trajectory Profile for this zone; must outlive the controller
+     */
+    void setTrajectory(SetpointTrajectory* trajectory) {
+        trajectory_ = trajectory;
+        if (trajectory_) trajectory_->reset(pid_.getSetpoint());
+    }
+
+    /**
+     * @brief Compensate transport delay between the heat source and the probe
+     *
+     * The PID then controls on the reading plus the response @p predictor
+     * expects but the probe has not seen yet, so the gains tuned for the
+     * delay-free zone stay usable. Applied after the estimator, if any;
+     * the derivative then comes from differencing. Pass nullptr to
+     * control on the reading again.
+     * @param predictor Predictor with this zone's model; must outlive the controller
+     */
+    void setSmithPredictor(SmithPredictor* predictor) {
+        smith_ = predictor;
+        if (smith_) smith_->reset();
+    }
+
+    /**
+     * @brief Identify the plant online and optionally retune from it
+     *
+     * Every cycle the raw reading and the output held over the interval
+     * go through @p identifier. With @p adapt_interval > 0, every that
+     * many cycles the identifier's PI proposal (rate-limited, kd kept) is
+     * applied and published through the same channel as tunePID(), without
+     * waiting: if another thread is publishing a config at that moment,
+     * that interval's proposal is dropped. integral_max is scaled with ki
+     * so the integral's share of the output keeps its limit. With 0 the
+     * gains are only proposed: see PlantIdentifier::propose().
+     * Pass nullptr to stop identifying.
+     * @param identifier Identifier for this zone; must outlive the controller
+     * @param adapt_interval Cycles between gain updates, 0 to never apply
+     */
+    void setIdentifier(PlantIdentifier* identifier, uint32_t adapt_interval = 0) {
+        identifier_ = identifier;
+        adapt_interval_ = adapt_interval;
+        adapt_countdown_ = adapt_interval;
+    }
+
+    /**
+     * @brief Single non-waiting snapshot attempt
+     * @param out Receives the snapshot on success
+     * @return false if the control thread was publishing
+     */
+    bool trySnapshot(Snapshot& out) const {
+        return snapshot_.tryRead(out);
+    }
+
+#ifdef TEMPCTRL_PROFILING
+    /**
+     * @brief Get per-phase cycle timing (TEMPCTRL_PROFILING builds only)
+     * @return Profiler with phase histograms
+     */
+    CycleProfiler& getProfiler() {
+        return profiler_;
+    }
+#endif
+
     /**
      * @brief Get control efficiency (percentage of time active)
      * @return Efficiency percentage (0-100%)
@@ -130,11 +447,92 @@ public:
     }
 
 private:
+    void persistWarmStart(float dt) {
+        if (!warm_start_) return;
+        if (trajectory_) {
+            // Save where the setpoint is going, not where the profile is
+            PIDController::Config config = pid_.getConfig();
+            config.setpoint = trajectory_->target();
+            warm_start_->update(config, pid_.getState(), dt);
+        } else {
+            warm_start_->update(pid_.getConfig(), pid_.getState(), dt);
+        }
+    }
+
+    void identifyPlant(float temp, float dt) {
+        identifier_->update(temp, actuator_.getOutput(), dt);
+        if (adapt_interval_ == 0 || --adapt_countdown_ > 0) return;
+        adapt_countdown_ = adapt_interval_;
+        if (!identifier_->model().valid) return;
+
+        // Never take the writer lock here: a lower-priority thread preempted
+        // inside setSetpoint() would stall the loop. If anything was published
+        // since the last applied config, or is being published, its change
+        // wins and the adaptation waits for the next interval.
+        PIDController::Config config;
+        uint32_t version;
+        if (!config_channel_.tryRead(config, &version) || version != applied_config_version_) return;
+        PIDController::Config proposed;
+        if (!identifier_->propose(config, proposed)) return;
+        if (config.ki > 0.0f && proposed.ki > 0.0f) {
+            proposed.integral_max = config.integral_max * config.ki / proposed.ki;
+        }
+        if (!config_channel_.tryWrite(proposed, version)) return;
+        pid_.retune(proposed);
+        applied_config_version_ = version + 2;
+        stats_.gain_adaptations++;
+    }
+
+    /**
+     * @brief Publish PID state and statistics for snapshot readers
+     */
+    void publishSnapshot() {
+        if (!publish_snapshots_) return;
+        Snapshot snap;
+        snap.pid = pid_.getState();
+        snap.stats = stats_;
+        snap.setpoint = pid_.getSetpoint();
+        snapshot_.writeExclusive(snap);
+    }
+
+    /**
+     * @brief Adopt a newly published configuration, if any, without waiting
+     *
+     * A write still in progress is picked up on a later cycle. Gain
+     * changes are bumpless: the integral term keeps its output share.
+     */
+    void applyPendingConfig() {
+        if (config_channel_.version() == applied_config_version_) return;
+        PIDController::Config config;
+        uint32_t version;
+        if (config_channel_.tryRead(config, &version)) {
+            pid_.retune(config);
+            if (trajectory_) trajectory_->setTarget(config.setpoint);
+            applied_config_version_ = version;
+        }
+    }
+
+    /**
+     * @brief Decide whether this cycle can be skipped in send-on-delta mode
+     * @param temp Current temperature reading
+     * @return true if PID/actuator/logging work should be skipped
+     */
+    bool shouldHold(float temp) const {
+        if (!event_config_.enabled || !has_processed_) return false;
+        if (silent_cycles_ + 1 >= event_config_.max_silent_cycles) return false;
+        // A new setpoint or new gains (or a moving trajectory) changes the output, not the reading
+        if (applied_config_version_ != processed_config_version_) return false;
+        if (pid_.getSetpoint() != last_processed_setpoint_) return false;
+        float delta = temp - last_processed_temp_;
+        return delta < event_config_.deadband && delta > -event_config_.deadband;
+    }
+
     /**
      * @brief Update running statistics
      * @param temp Current temperature reading
      */
     void updateStatistics(float temp) {
+        stats_.last_temp = temp;
         stats_.min_temp = std::min(stats_.min_temp, temp);
         stats_.max_temp = std::max(stats_.max_temp, temp);
         stats_.temp_sum += temp;
@@ -151,10 +549,12 @@ private:
         const auto& pid_state = pid_.getState();
         
         // Use printf for detailed logging since ILogger only supports float values
-        printf("Temp=%.1f°C -> Output=%.1f%% (P=%.1f I=%.1f D=%.1f) [%s]\n",
-                temp, output,
-                pid_state.p_term, pid_state.i_term, pid_state.d_term,
-                pid_.getStatusString());
+        if (detailed_trace_) {
+            printf("Temp=%.1f°C -> Output=%.1f%% (P=%.1f I=%.1f D=%.1f) [%s]\n",
+                    temp, output,
+                    pid_state.p_term, pid_state.i_term, pid_state.d_term,
+                    pid_.getStatusString());
+        }
         
         // Also log the temperature value to the logger interface
         logger_.log(temp);
@@ -0,0 +1,387 @@
+#pragma once
+
+/**
+ * @file CommandProtocol.hpp
+ * @brief Framed binary command protocol over the UART receive ring
+ *
+ * Frame layout (multi-byte fields little-endian):
+ *
+ *   0xA5 | LEN | CMD | SEQ | payload[LEN] | CRC16
+ *
+ * LEN is the payload length (at most kMaxPayload). CRC16 is CRC-16/CCITT-FALSE
+ * over LEN, CMD, SEQ and the payload. A reply uses CMD | 0x80 and the
+ * request's SEQ; its payload starts with a Status byte.
+ *
+ * Frames are validated and decoded in place in the ByteRing: no copy of
+ * the frame, no heap. Each poll() examines at most kScanBudget bytes and
+ * dispatches at most one frame, so its worst-case latency is bounded no
+ * matter what arrives on the line. Handlers are looked up through a
+ * table built at compile time.
+ */
+
+#include "ByteRing.hpp"
+#include "drivers.hpp"
+#include "Crc.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include <cmath>
+#include <cstring>
+
+namespace protocol {
+
+constexpr uint8_t kStartOfFrame = 0xA5;
+constexpr size_t kHeaderSize = 4;                // SOF, LEN, CMD, SEQ
+constexpr size_t kCrcSize = 2;
+constexpr size_t kMaxPayload = 64;
+constexpr size_t kMaxFrame = kHeaderSize + kMaxPayload + kCrcSize;
+constexpr uint8_t kReplyFlag = 0x80;
+
+enum Command : uint8_t {
+    SetSetpoint = 0x01,     // f32 setpoint
+    SetGains = 0x02,        // f32 kp, ki, kd
+    ReadStats = 0x03,       // -> u32 cycles, u32 skipped, f32 last/min/max/avg, f32 output, f32 setpoint
+    ReadHistory = 0x04,     // u8 count -> u8 n, n x i16 centi-°C (oldest first)
+};
+
+enum Status : uint8_t {
+    Ok = 0,
+    UnknownCommand = 1,
+    BadLength = 2,
+    BadValue = 3,
+};
+
+/**
+ * @brief Payload of a validated frame, read in place from the ring
+ */
+class FrameView {
+public:
+    FrameView(const ByteRing& ring, uint8_t command, uint8_t sequence, uint8_t length)
+        : ring_(ring), command_(command), sequence_(sequence), length_(length) {}
+
+    uint8_t command() const { return command_; }
+    uint8_t sequence() const { return sequence_; }
+    uint8_t length() const { return length_; }
+
+    uint8_t u8(size_t offset) const {
+        return ring_.peek(kHeaderSize + offset);
+    }
+
+    // Fields may straddle the end of the ring storage, so assemble bytewise
+    uint32_t u32(size_t offset) const {
+        return static_cast<uint32_t>(u8(offset)) | static_cast<uint32_t>(u8(offset + 1)) << 8 |
+               static_cast<uint32_t>(u8(offset + 2)) << 16 | static_cast<uint32_t>(u8(offset + 3)) << 24;
+    }
+
+    float f32(size_t offset) const {
+        uint32_t bits = u32(offset);
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+private:
+    const ByteRing& ring_;
+    uint8_t command_;
+    uint8_t sequence_;
+    uint8_t length_;
+};
+
+/**
+ * @brief Reply frame assembled on the stack
+ */
+class Reply {
+public:
+    Reply(uint8_t command, uint8_t sequence) {
+        frame_[0] = kStartOfFrame;
+        frame_[2] = command | kReplyFlag;
+        frame_[3] = sequence;
+    }
+
+    void u8(uint8_t value) {
+        if (length_ < kMaxPayload) frame_[kHeaderSize + length_++] = value;
+    }
+
+    void i16(int16_t value) {
+        u8(static_cast<uint8_t>(value));
+        u8(static_cast<uint8_t>(static_cast<uint16_t>(value) >> 8));
+    }
+
+    void u32(uint32_t value) {
+        for (int shift = 0; shift < 32; shift += 8) u8(static_cast<uint8_t>(value >> shift));
+    }
+
+    void f32(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        u32(bits);
+    }
+
+    /**
+     * @brief Close the frame; valid until the Reply is destroyed
+     */
+    const uint8_t* finish(size_t& size) {
+        frame_[1] = static_cast<uint8_t>(length_);
+        uint16_t crc = crc::crc16(frame_ + 1, kHeaderSize - 1 + length_);
+        frame_[kHeaderSize + length_] = static_cast<uint8_t>(crc);
+        frame_[kHeaderSize + length_ + 1] = static_cast<uint8_t>(crc >> 8);
+        size = kHeaderSize + length_ + kCrcSize;
+        return frame_;
+    }
+
+    size_t payloadLength() const { return length_; }
+
+private:
+    uint8_t frame_[kMaxFrame];
+    size_t length_ = 0;
+};
+
+} // namespace protocol
+
+/**
+ * @brief Parses command frames from a receive ring and answers on the UART
+ *
+ * poll() and recordSample() must run on the same thread (normally the
+ * control loop); the ring's producer may be an interrupt or another
+ * thread. Setpoint and gain commands go through the controller's config
+ * channel and apply at its next cycle.
+ */
+class CommandServer {
+public:
+    // Enough for one maximum frame plus a frame's worth of resync
+    static constexpr size_t kScanBudget = 2 * protocol::kMaxFrame;
+    static constexpr uint32_t kFrameTimeoutMs = 50;   // Partial frame older than this is dropped
+    static constexpr size_t kHistorySize = 32;
+
+    enum class PollResult {
+        Idle,           // Nothing buffered
+        Incomplete,     // Waiting for the rest of a frame
+        Frame,          // One frame dispatched
+        Busy,           // Budget used up by resync; more to examine
+    };
+
+    struct Stats {
+        uint32_t frames = 0;
+        uint32_t crc_errors = 0;
+        uint32_t length_errors = 0;
+        uint32_t unknown_commands = 0;
+        uint32_t timeouts = 0;
+        uint32_t discarded_bytes = 0;
+        size_t max_examined = 0;    // Worst bytes examined by one poll()
+    };
+
+    using Handler = protocol::Status (*)(CommandServer&, const protocol::FrameView&, protocol::Reply&);
+
+    struct CommandSpec {
+        uint8_t command;
+        uint8_t min_length;
+        uint8_t max_length;
+        Handler handler;
+    };
+
+    CommandServer(ByteRing& rx, UartDriver& tx, AdvancedTemperatureController& controller)
+        : rx_(rx), tx_(tx), controller_(controller) {}
+
+    /**
+     * @brief Examine buffered bytes and dispatch at most one frame
+     * @param now_ms Monotonic milliseconds, for the partial-frame timeout
+     */
+    PollResult poll(uint32_t now_ms) {
+        size_t examined = 0;
+        PollResult result = scan(now_ms, examined);
+        if (examined > stats_.max_examined) stats_.max_examined = examined;
+        return result;
+    }
+
+    /**
+     * @brief Append a reading to the history served by ReadHistory
+     */
+    void recordSample(float celsius) {
+        float centi = std::nearbyint(celsius * 100.0f);
+        centi = std::max(-32768.0f, std::min(32767.0f, centi));
+        history_[history_count_++ % kHistorySize] = static_cast<int16_t>(centi);
+    }
+
+    const Stats& getStats() const { return stats_; }
+
+private:
+    PollResult scan(uint32_t now_ms, size_t& examined) {
+        using namespace protocol;
+        while (examined < kScanBudget) {
+            size_t available = rx_.available();
+            if (available == 0) return PollResult::Idle;
+
+            examined++;
+            if (rx_.peek(0) != kStartOfFrame) {
+                dropByte();
+                continue;
+            }
+            if (available < 2) return waitFor(now_ms);
+
+            uint8_t length = rx_.peek(1);
+            if (length > kMaxPayload) {
+                stats_.length_errors++;
+                dropByte();
+                continue;
+            }
+            size_t frame_size = kHeaderSize + length + kCrcSize;
+            if (available < frame_size) return waitFor(now_ms);
+            if (examined + frame_size > kScanBudget) return PollResult::Busy;
+            examined += frame_size;
+
+            if (!crcMatches(length)) {
+                // Resync from the byte after this SOF
+                stats_.crc_errors++;
+                dropByte();
+                continue;
+            }
+
+            pending_since_valid_ = false;
+            FrameView frame(rx_, rx_.peek(2), rx_.peek(3), length);
+            dispatch(frame);
+            rx_.consume(frame_size);
+            stats_.frames++;
+            return PollResult::Frame;
+        }
+        return PollResult::Busy;
+    }
+
+    PollResult waitFor(uint32_t now_ms) {
+        if (!pending_since_valid_) {
+            pending_since_ = now_ms;
+            pending_since_valid_ = true;
+        } else if (now_ms - pending_since_ > kFrameTimeoutMs) {
+            // A stray SOF (or a sender that died mid-frame) must not block the line
+            stats_.timeouts++;
+            dropByte();
+        }
+        return PollResult::Incomplete;
+    }
+
+    void dropByte() {
+        rx_.consume(1);
+        stats_.discarded_bytes++;
+        pending_since_valid_ = false;
+    }
+
+    // CRC over LEN..payload in place, in at most two contiguous runs
+    bool crcMatches(uint8_t length) const {
+        using namespace protocol;
+        size_t remaining = kHeaderSize - 1 + length;
+        size_t offset = 1;
+        uint16_t crc = crc::kCrc16Init;
+        while (remaining > 0) {
+            size_t run = 0;
+            const uint8_t* bytes = rx_.span(offset, remaining, run);
+            crc = crc::crc16(bytes, run, crc);
+            offset += run;
+            remaining -= run;
+        }
+        uint16_t received = static_cast<uint16_t>(rx_.peek(offset) | rx_.peek(offset + 1) << 8);
+        return crc == received;
+    }
+
+    void dispatch(const protocol::FrameView& frame) {
+        using namespace protocol;
+        Reply reply(frame.command(), frame.sequence());
+        uint8_t index = kCommandIndex.entries[frame.command()];
+        Status status;
+        if (index == 0) {
+            stats_.unknown_commands++;
+            status = UnknownCommand;
+            reply.u8(status);
+        } else {
+            const CommandSpec& spec = kCommands[index - 1];
+            if (frame.length() < spec.min_length || frame.length() > spec.max_length) {
+                status = BadLength;
+                reply.u8(status);
+            } else {
+                reply.u8(Ok);
+                status = spec.handler(*this, frame, reply);
+                if (status != Ok) {
+                    reply = Reply(frame.command(), frame.sequence());
+                    reply.u8(status);
+                }
+            }
+        }
+        size_t size = 0;
+        const uint8_t* bytes = reply.finish(size);
+        tx_.writeBytes(bytes, size);
+    }
+
+    // Handlers: the Ok status byte is already in the reply
+
+    static protocol::Status setSetpoint(CommandServer& server, const protocol::FrameView& frame, protocol::Reply&) {
+        float setpoint = frame.f32(0);
+        if (!std::isfinite(setpoint) || setpoint < -40.0f || setpoint > 125.0f) return protocol::BadValue;
+        server.controller_.setSetpoint(setpoint);
+        return protocol::Ok;
+    }
+
+    static protocol::Status setGains(CommandServer& server, const protocol::FrameView& frame, protocol::Reply&) {
+        float kp = frame.f32(0);
+        float ki = frame.f32(4);
+        float kd = frame.f32(8);
+        for (float gain : {kp, ki, kd}) {
+            if (!std::isfinite(gain) || gain < 0.0f) return protocol::BadValue;
+        }
+        server.controller_.tunePID(kp, ki, kd);
+        return protocol::Ok;
+    }
+
+    static protocol::Status readStats(CommandServer& server, const protocol::FrameView&, protocol::Reply& reply) {
+        AdvancedTemperatureController::Snapshot snap = server.controller_.snapshot();
+        reply.u32(snap.stats.total_cycles);
+        reply.u32(snap.stats.skipped_cycles);
+        reply.f32(snap.stats.last_temp);
+        reply.f32(snap.stats.min_temp);
+        reply.f32(snap.stats.max_temp);
+        reply.f32(snap.stats.avg_temp);
+        reply.f32(snap.pid.output);
+        reply.f32(snap.setpoint);
+        return protocol::Ok;
+    }
+
+    static protocol::Status readHistory(CommandServer& server, const protocol::FrameView& frame, protocol::Reply& reply) {
+        constexpr size_t kMaxSamples = (protocol::kMaxPayload - 2) / 2;
+        size_t stored = server.history_count_ < kHistorySize ? server.history_count_ : kHistorySize;
+        size_t count = std::min<size_t>({frame.u8(0), stored, kMaxSamples});
+        reply.u8(static_cast<uint8_t>(count));
+        for (size_t i = count; i > 0; i--) {
+            reply.i16(server.history_[(server.history_count_ - i) % kHistorySize]);
+        }
+        return protocol::Ok;
+    }
+
+    static constexpr CommandSpec kCommands[] = {
+        {protocol::SetSetpoint, 4, 4, &CommandServer::setSetpoint},
+        {protocol::SetGains, 12, 12, &CommandServer::setGains},
+        {protocol::ReadStats, 0, 0, &CommandServer::readStats},
+        {protocol::ReadHistory, 1, 1, &CommandServer::readHistory},
+    };
+
+    // Command byte -> 1-based index into kCommands (0 = unknown)
+    struct CommandIndex {
+        uint8_t entries[256];
+    };
+
+    static constexpr CommandIndex buildIndex() {
+        CommandIndex index{};
+        for (size_t i = 0; i < sizeof(kCommands) / sizeof(kCommands[0]); i++) {
+            index.entries[kCommands[i].command] = static_cast<uint8_t>(i + 1);
+        }
+        return index;
+    }
+
+    static const CommandIndex kCommandIndex;
+
+    ByteRing& rx_;
+    UartDriver& tx_;
+    AdvancedTemperatureController& controller_;
+    int16_t history_[kHistorySize] = {};
+    size_t history_count_ = 0;
+    uint32_t pending_since_ = 0;
+    bool pending_since_valid_ = false;
+    Stats stats_;
+};
+
+// Defined out of line: buildIndex() needs the complete class
+inline constexpr CommandServer::CommandIndex CommandServer::kCommandIndex = CommandServer::buildIndex();
@@ -0,0 +1,475 @@
+#pragma once
+
+/**
+ * @file CoopScheduler.hpp
+ * @brief Single-threaded cooperative scheduler for C++20 coroutine tasks
+ *
+ * Each control loop is a CoopTask coroutine that awaits ticks
+ * (sleepUntil/sleepFor) and CoopEvents (sensor ready, UART ready)
+ * instead of blocking a thread. Frames come from a fixed FramePool, and
+ * every queue is an intrusive list threaded through awaiters that live in
+ * the suspended frames, so nothing allocates after start-up.
+ *
+ * Time is an abstract microsecond counter advanced by the caller:
+ * virtual time in simulation, k_uptime on target. Timers fire at their
+ * exact deadlines, so periodic loops written with sleepUntil do not
+ * drift.
+ *
+ * Optional: requires C++20 (configure with -DTEMPCTRL_COROUTINES=ON).
+ */
+
+#if __cplusplus < 202002L
+    #error "CoopScheduler.hpp requires C++20; configure with -DTEMPCTRL_COROUTINES=ON"
+#endif
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+
+/**
+ * @brief Fixed-size blocks for coroutine frames
+ *
+ * Each block starts with a header naming its pool, so a frame can be
+ * returned from the promise's operator delete without global state.
+ */
+class FramePool {
+public:
+    /**
+     * @param storage Block storage, max_align_t aligned, block_size * blocks bytes
+     * @param block_size Bytes per block, including kHeaderSize
+     * @param blocks Number of blocks
+     */
+    FramePool(void* storage, size_t block_size, size_t blocks)
+        : block_size_(block_size), capacity_(blocks) {
+        unsigned char* bytes = static_cast<unsigned char*>(storage);
+        for (size_t i = blocks; i-- > 0;) {
+            Block* block = reinterpret_cast<Block*>(bytes + i * block_size);
+            block->next = free_;
+            free_ = block;
+        }
+    }
+
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    /**
+     * @return Frame memory, or nullptr if @p size does not fit or the pool is empty
+     */
+    void* allocate(size_t size) noexcept {
+        if (size + kHeaderSize > largest_request_) largest_request_ = size + kHeaderSize;
+        if (size + kHeaderSize > block_size_ || free_ == nullptr) {
+            failed_++;
+            return nullptr;
+        }
+        Block* block = free_;
+        free_ = block->next;
+        block->pool = this;
+        in_use_++;
+        return reinterpret_cast<unsigned char*>(block) + kHeaderSize;
+    }
+
+    static void release(void* frame) noexcept {
+        Block* block = reinterpret_cast<Block*>(static_cast<unsigned char*>(frame) - kHeaderSize);
+        FramePool* pool = block->pool;
+        block->next = pool->free_;
+        pool->free_ = block;
+        pool->in_use_--;
+    }
+
+    size_t blockSize() const { return block_size_; }
+    size_t capacity() const { return capacity_; }
+    size_t inUse() const { return in_use_; }
+    size_t failedAllocations() const { return failed_; }
+    /** Largest frame requested so far, header included (size blocks from this) */
+    size_t largestRequest() const { return largest_request_; }
+
+    static constexpr size_t kHeaderSize = alignof(std::max_align_t);
+
+private:
+    union Block {
+        Block* next;          // While free
+        FramePool* pool;      // While allocated
+    };
+
+    Block* free_ = nullptr;
+    size_t block_size_;
+    size_t capacity_;
+    size_t in_use_ = 0;
+    size_t failed_ = 0;
+    size_t largest_request_ = 0;
+};
+
+/**
+ * @brief FramePool with its storage inline (static or member allocation)
+ */
+template <size_t BlockSize, size_t Blocks>
+class StaticFramePool : public FramePool {
+    static_assert(BlockSize % alignof(std::max_align_t) == 0, "block size must keep frames aligned");
+
+public:
+    StaticFramePool() : FramePool(storage_, BlockSize, Blocks) {}
+
+private:
+    alignas(std::max_align_t) unsigned char storage_[BlockSize * Blocks];
+};
+
+class CoopScheduler;
+
+/**
+ * @brief Queue link for one suspended task; lives in the awaiting frame
+ */
+struct CoopWaiter {
+    std::coroutine_handle<> handle;
+    CoopWaiter* next = nullptr;
+    CoopWaiter* prev = nullptr;
+    uint64_t deadline = 0;
+};
+
+/**
+ * @brief Handle to a coroutine that runs under a CoopScheduler
+ *
+ * The coroutine's first parameter must be the CoopScheduler&: its frame is
+ * allocated from that scheduler's pool. Created suspended; spawn() starts
+ * it. If the pool is exhausted the task is invalid and spawn() refuses it.
+ */
+class CoopTask {
+public:
+    struct promise_type {
+        template <typename... Args>
+        promise_type(CoopScheduler& scheduler, Args&&...) : scheduler(&scheduler) {}
+
+        template <typename... Args>
+        static void* operator new(size_t size, CoopScheduler& scheduler, Args&&...) noexcept;
+
+        static void operator delete(void* frame) noexcept {
+            FramePool::release(frame);
+        }
+
+        static CoopTask get_return_object_on_allocation_failure() noexcept {
+            return CoopTask{};
+        }
+
+        CoopTask get_return_object() noexcept {
+            return CoopTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        // Finished tasks hand their frame back immediately
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+            void await_suspend(std::coroutine_handle<promise_type> handle) noexcept;
+            void await_resume() noexcept {}
+        };
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+
+        CoopScheduler* scheduler;
+        CoopWaiter start;                   // Ready-queue link until the first suspension
+        promise_type* next_live = nullptr;
+        promise_type* prev_live = nullptr;
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    CoopTask() = default;
+    CoopTask(CoopTask&& other) noexcept : handle_(other.handle_) { other.handle_ = nullptr; }
+    CoopTask& operator=(CoopTask&& other) noexcept {
+        if (this != &other) {
+            if (handle_) handle_.destroy();
+            handle_ = other.handle_;
+            other.handle_ = nullptr;
+        }
+        return *this;
+    }
+    CoopTask(const CoopTask&) = delete;
+    CoopTask& operator=(const CoopTask&) = delete;
+    ~CoopTask() {
+        if (handle_) handle_.destroy();
+    }
+
+    bool valid() const { return static_cast<bool>(handle_); }
+
+private:
+    friend class CoopScheduler;
+    explicit CoopTask(Handle handle) : handle_(handle) {}
+
+    Handle release() {
+        Handle handle = handle_;
+        handle_ = nullptr;
+        return handle;
+    }
+
+    Handle handle_;
+};
+
+/**
+ * @brief Runs CoopTasks on the calling thread
+ *
+ * Not thread-safe: spawn, signal and advance from the thread (or, on
+ * target, the single loop) that owns the scheduler.
+ */
+class CoopScheduler {
+public:
+    struct Stats {
+        uint64_t resumes = 0;
+        uint32_t live_tasks = 0;
+        uint32_t peak_tasks = 0;
+    };
+
+    explicit CoopScheduler(FramePool& pool) : pool_(pool) {}
+
+    CoopScheduler(const CoopScheduler&) = delete;
+    CoopScheduler& operator=(const CoopScheduler&) = delete;
+
+    // Tasks still suspended (endless loops) are destroyed, returning their frames
+    ~CoopScheduler() {
+        while (live_) {
+            CoopTask::promise_type* promise = live_;
+            unlinkLive(promise);
+            CoopTask::Handle::from_promise(*promise).destroy();
+        }
+    }
+
+    /**
+     * @brief Queue a task; it runs to its first suspension at the next
+     *        runReady() or advanceTo()
+     * @return false if the task is invalid (its frame did not fit the pool)
+     */
+    bool spawn(CoopTask task) {
+        if (!task.valid()) return false;
+        CoopTask::Handle handle = task.release();
+        CoopTask::promise_type& promise = handle.promise();
+        promise.next_live = live_;
+        if (live_) live_->prev_live = &promise;
+        live_ = &promise;
+        stats_.live_tasks++;
+        if (stats_.live_tasks > stats_.peak_tasks) stats_.peak_tasks = stats_.live_tasks;
+
+        promise.start.handle = handle;
+        makeReady(&promise.start);
+        return true;
+    }
+
+    struct SleepAwaiter {
+        CoopScheduler& scheduler;
+        CoopWaiter waiter;
+
+        bool await_ready() const noexcept { return waiter.deadline <= scheduler.now_; }
+        void await_suspend(std::coroutine_handle<> handle) noexcept {
+            waiter.handle = handle;
+            scheduler.addTimer(&waiter);
+        }
+        void await_resume() const noexcept {}
+    };
+
+    /**
+     * @brief Suspend until now() reaches @p deadline_us (returns at once if passed)
+     */
+    SleepAwaiter sleepUntil(uint64_t deadline_us) {
+        SleepAwaiter awaiter{*this, {}};
+        awaiter.waiter.deadline = deadline_us;
+        return awaiter;
+    }
+
+    SleepAwaiter sleepFor(uint64_t duration_us) {
+        return sleepUntil(now_ + duration_us);
+    }
+
+    /**
+     * @brief Resume every ready task, including ones made ready meanwhile
+     * @return Number of resumes
+     */
+    size_t runReady() {
+        if (running_) return 0;     // Called from inside a task: the outer pass continues
+        running_ = true;
+        size_t resumed = 0;
+        while (ready_head_) {
+            CoopWaiter* waiter = ready_head_;
+            ready_head_ = waiter->next;
+            if (!ready_head_) ready_tail_ = nullptr;
+            waiter->next = nullptr;
+            resumed++;
+            waiter->handle.resume();
+        }
+        running_ = false;
+        stats_.resumes += resumed;
+        return resumed;
+    }
+
+    /**
+     * @brief Move time forward, firing each timer at its own deadline
+     */
+    void advanceTo(uint64_t time_us) {
+        runReady();
+        while (timers_head_ && timers_head_->deadline <= time_us) {
+            now_ = timers_head_->deadline;
+            while (timers_head_ && timers_head_->deadline == now_) {
+                CoopWaiter* waiter = timers_head_;
+                timers_head_ = waiter->next;
+                if (timers_head_) {
+                    timers_head_->prev = nullptr;
+                } else {
+                    timers_tail_ = nullptr;
+                }
+                makeReady(waiter);
+            }
+            runReady();
+        }
+        if (time_us > now_) now_ = time_us;
+    }
+
+    /**
+     * @brief Earliest pending deadline (UINT64_MAX if none); how long a target may idle
+     */
+    uint64_t nextDeadline() const {
+        return timers_head_ ? timers_head_->deadline : UINT64_MAX;
+    }
+
+    uint64_t now() const { return now_; }
+    const Stats& getStats() const { return stats_; }
+    FramePool& pool() { return pool_; }
+
+private:
+    friend class CoopEvent;
+    friend struct CoopTask::promise_type;
+
+    void makeReady(CoopWaiter* waiter) {
+        waiter->next = nullptr;
+        if (ready_tail_) {
+            ready_tail_->next = waiter;
+        } else {
+            ready_head_ = waiter;
+        }
+        ready_tail_ = waiter;
+    }
+
+    // Sorted by deadline. Periodic ticks land near the tail and short
+    // waits (conversions, byte times) near the head, so scan from the
+    // nearer end
+    void addTimer(CoopWaiter* waiter) {
+        CoopWaiter* after;
+        if (!timers_tail_ || waiter->deadline >= timers_tail_->deadline) {
+            after = timers_tail_;
+        } else if (waiter->deadline < timers_head_->deadline) {
+            after = nullptr;
+        } else if (waiter->deadline - timers_head_->deadline < timers_tail_->deadline - waiter->deadline) {
+            after = timers_head_;
+            while (after->next->deadline <= waiter->deadline) after = after->next;
+        } else {
+            after = timers_tail_;
+            while (after->deadline > waiter->deadline) after = after->prev;
+        }
+        waiter->prev = after;
+        waiter->next = after ? after->next : timers_head_;
+        if (waiter->next) {
+            waiter->next->prev = waiter;
+        } else {
+            timers_tail_ = waiter;
+        }
+        if (after) {
+            after->next = waiter;
+        } else {
+            timers_head_ = waiter;
+        }
+    }
+
+    void unlinkLive(CoopTask::promise_type* promise) {
+        if (promise->prev_live) {
+            promise->prev_live->next_live = promise->next_live;
+        } else {
+            live_ = promise->next_live;
+        }
+        if (promise->next_live) promise->next_live->prev_live = promise->prev_live;
+        stats_.live_tasks--;
+    }
+
+    void retire(CoopTask::Handle handle) {
+        unlinkLive(&handle.promise());
+        handle.destroy();
+    }
+
+    FramePool& pool_;
+    uint64_t now_ = 0;
+    CoopWaiter* ready_head_ = nullptr;
+    CoopWaiter* ready_tail_ = nullptr;
+    CoopWaiter* timers_head_ = nullptr;
+    CoopWaiter* timers_tail_ = nullptr;
+    CoopTask::promise_type* live_ = nullptr;
+    bool running_ = false;
+    Stats stats_;
+};
+
+/**
+ * @brief Auto-reset event: signal() wakes the longest waiter, or is
+ *        remembered for the next wait() if nobody is waiting
+ *
+ * Typical sources are an ADC conversion-complete or UART TX-empty
+ * interrupt, forwarded to the scheduler's thread.
+ */
+class CoopEvent {
+public:
+    explicit CoopEvent(CoopScheduler& scheduler) : scheduler_(scheduler) {}
+
+    CoopEvent(const CoopEvent&) = delete;
+    CoopEvent& operator=(const CoopEvent&) = delete;
+
+    struct Awaiter {
+        CoopEvent& event;
+        CoopWaiter waiter;
+
+        bool await_ready() noexcept {
+            if (!event.signaled_) return false;
+            event.signaled_ = false;
+            return true;
+        }
+        void await_suspend(std::coroutine_handle<> handle) noexcept {
+            waiter.handle = handle;
+            event.enqueue(&waiter);
+        }
+        void await_resume() const noexcept {}
+    };
+
+    Awaiter wait() { return Awaiter{*this, {}}; }
+
+    void signal() {
+        if (!head_) {
+            signaled_ = true;
+            return;
+        }
+        CoopWaiter* waiter = head_;
+        head_ = waiter->next;
+        if (!head_) tail_ = nullptr;
+        scheduler_.makeReady(waiter);
+    }
+
+    bool hasWaiters() const { return head_ != nullptr; }
+
+private:
+    void enqueue(CoopWaiter* waiter) {
+        waiter->next = nullptr;
+        if (tail_) {
+            tail_->next = waiter;
+        } else {
+            head_ = waiter;
+        }
+        tail_ = waiter;
+    }
+
+    CoopScheduler& scheduler_;
+    CoopWaiter* head_ = nullptr;
+    CoopWaiter* tail_ = nullptr;
+    bool signaled_ = false;
+};
+
+template <typename... Args>
+void* CoopTask::promise_type::operator new(size_t size, CoopScheduler& scheduler, Args&&...) noexcept {
+    return scheduler.pool().allocate(size);
+}
+
+inline void CoopTask::promise_type::FinalAwaiter::await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+    handle.promise().scheduler->retire(handle);
+}
@@ -0,0 +1,245 @@
+#pragma once
+
+/**
+ * @file CycleProfiler.hpp
+ * @brief Per-phase timing of the regulation cycle
+ *
+ * Records how long each phase of AdvancedTemperatureController::regulate()
+ * takes into fixed-size log-linear histograms, with worst-case tracking.
+ * Timestamps come from k_cycle_get_32() on target and clock_gettime() in
+ * the simulation build.
+ *
+ * Instrumentation in the controller is enabled by defining
+ * TEMPCTRL_PROFILING; without it the TEMPCTRL_PROFILE_* macros expand to
+ * nothing and the controller carries no profiler member.
+ *
+ * One cycle in TEMPCTRL_PROFILING_INTERVAL is timed. On target the
+ * default is 1: k_cycle_get_32() is a single register read, and worst-case
+ * tracking has to see every cycle. In the simulation build clock_gettime()
+ * costs far more than the bookkeeping around it, so the default there is 8.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#ifndef TEMPCTRL_PROFILING_INTERVAL
+    #ifdef SIMULATION_BUILD
+        #define TEMPCTRL_PROFILING_INTERVAL 8
+    #else
+        #define TEMPCTRL_PROFILING_INTERVAL 1
+    #endif
+#endif
+
+#ifdef SIMULATION_BUILD
+    #include <time.h>
+#else
+    #include <zephyr.h>
+#endif
+
+/**
+ * @brief Log-linear latency histogram
+ *
+ * Values below 4 get their own bucket; above that every power of two is
+ * split into 4 sub-buckets, so the bucket width is at most 25% of its
+ * value across the full 32-bit range in 124 counters.
+ */
+class LatencyHistogram {
+public:
+    static constexpr unsigned kSubBuckets = 4;
+    static constexpr unsigned kBuckets = 31 * kSubBuckets;
+
+    static unsigned bucketFor(uint32_t value) {
+        if (value < kSubBuckets) return value;
+        unsigned exponent = 31u - static_cast<unsigned>(__builtin_clz(value));
+        unsigned sub = (value >> (exponent - 2)) & (kSubBuckets - 1);
+        return (exponent - 1) * kSubBuckets + sub;
+    }
+
+    static uint32_t bucketLowerBound(unsigned bucket) {
+        if (bucket < kSubBuckets) return bucket;
+        unsigned exponent = bucket / kSubBuckets + 1;
+        unsigned sub = bucket % kSubBuckets;
+        return (kSubBuckets + sub) << (exponent - 2);
+    }
+
+    void record(uint32_t value) {
+        counts_[bucketFor(value)]++;
+        count_++;
+        if (value > max_) max_ = value;
+    }
+
+    /**
+     * @brief Approximate percentile (lower bound of the containing bucket)
+     * @param percent Percentile in 0-100
+     */
+    uint32_t percentile(float percent) const {
+        if (count_ == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(percent / 100.0f * (count_ - 1));
+        uint64_t seen = 0;
+        for (unsigned i = 0; i < kBuckets; ++i) {
+            seen += counts_[i];
+            if (seen > rank) return bucketLowerBound(i);
+        }
+        return max_;
+    }
+
+    uint32_t count() const { return count_; }
+    uint32_t max() const { return max_; }
+    uint32_t bucketCount(unsigned bucket) const { return counts_[bucket]; }
+
+    void reset() { *this = LatencyHistogram{}; }
+
+private:
+    uint32_t counts_[kBuckets] = {};
+    uint32_t count_ = 0;
+    uint32_t max_ = 0;
+};
+
+class CycleProfiler {
+public:
+    enum Phase : uint8_t {
+        Sensor,
+        Statistics,
+        Pid,
+        Actuator,
+        Logging,
+        Total,
+        PhaseCount
+    };
+
+    /**
+     * @brief Read the free-running timestamp counter
+     * @return Ticks (CPU cycles on target, nanoseconds in simulation)
+     */
+    static inline uint32_t now() {
+#ifdef SIMULATION_BUILD
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint32_t>(ts.tv_sec * 1000000000ull + ts.tv_nsec);
+#else
+        return k_cycle_get_32();
+#endif
+    }
+
+    /**
+     * @brief Timestamp ticks per second
+     */
+    static inline uint32_t ticksPerSecond() {
+#ifdef SIMULATION_BUILD
+        return 1000000000u;
+#else
+        return sys_clock_hw_cycles_per_sec();
+#endif
+    }
+
+    static const char* phaseName(Phase phase) {
+        static const char* const names[PhaseCount] = {
+            "sensor", "stats", "pid", "actuator", "logging", "total"
+        };
+        return names[phase];
+    }
+
+    /**
+     * @brief Start a cycle; only every sample-interval'th cycle is timed
+     */
+    inline void begin() {
+        if (--countdown_ != 0) {
+            active_ = false;
+            return;
+        }
+        countdown_ = interval_;
+        active_ = true;
+        start_ = last_ = now();
+    }
+
+    /**
+     * @brief Close the current phase (time since the previous mark)
+     */
+    inline void mark(Phase phase) {
+        if (!active_) return;
+        uint32_t t = now();
+        histograms_[phase].record(t - last_);
+        last_ = t;
+    }
+
+    /**
+     * @brief Close the cycle; the total spans begin() to the last mark()
+     */
+    inline void end() {
+        if (!active_) return;
+        histograms_[Total].record(last_ - start_);
+    }
+
+    /**
+     * @brief Time one cycle in every @p interval (1 = every cycle)
+     */
+    void setSampleInterval(uint32_t interval) {
+        interval_ = interval == 0 ? 1 : interval;
+        countdown_ = 1;
+    }
+
+    uint32_t getSampleInterval() const {
+        return interval_;
+    }
+
+    const LatencyHistogram& histogram(Phase phase) const {
+        return histograms_[phase];
+    }
+
+    void reset() {
+        for (auto& h : histograms_) h.reset();
+        countdown_ = 1;
+    }
+
+    /**
+     * @brief Compact one-line-per-phase summary in microseconds
+     * @param buf Output buffer
+     * @param size Buffer size
+     * @return Number of characters written (excluding terminator)
+     */
+    size_t format(char* buf, size_t size) const {
+        const float us_per_tick = 1e6f / ticksPerSecond();
+        size_t used = 0;
+        for (unsigned p = 0; p < PhaseCount && used < size; ++p) {
+            const LatencyHistogram& h = histograms_[p];
+            int n = snprintf(buf + used, size - used,
+                             "%-8s n=%lu p50=%.2f p99=%.2f max=%.2f us\n",
+                             phaseName(static_cast<Phase>(p)),
+                             static_cast<unsigned long>(h.count()),
+                             h.percentile(50.0f) * us_per_tick,
+                             h.percentile(99.0f) * us_per_tick,
+                             h.max() * us_per_tick);
+            if (n < 0) break;
+            used += static_cast<size_t>(n);
+        }
+        return used < size ? used : size - 1;
+    }
+
+    /**
+     * @brief Print the summary to the console
+     */
+    void dump() const {
+        char buf[PhaseCount * 64];
+        format(buf, sizeof(buf));
+        printf("%s", buf);
+    }
+
+private:
+    LatencyHistogram histograms_[PhaseCount];
+    uint32_t start_ = 0;
+    uint32_t last_ = 0;
+    uint32_t interval_ = TEMPCTRL_PROFILING_INTERVAL;
+    uint32_t countdown_ = 1;    // First cycle is always timed
+    bool active_ = false;
+};
+
+#ifdef TEMPCTRL_PROFILING
+    #define TEMPCTRL_PROFILE_BEGIN(profiler) (profiler).begin()
+    #define TEMPCTRL_PROFILE_MARK(profiler, phase) (profiler).mark(CycleProfiler::phase)
+    #define TEMPCTRL_PROFILE_END(profiler) (profiler).end()
+#else
+    #define TEMPCTRL_PROFILE_BEGIN(profiler) ((void)0)
+    #define TEMPCTRL_PROFILE_MARK(profiler, phase) ((void)0)
+    #define TEMPCTRL_PROFILE_END(profiler) ((void)0)
+#endif
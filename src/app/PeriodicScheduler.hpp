@@ -0,0 +1,206 @@
+#pragma once
+
+/**
+ * @file PeriodicScheduler.hpp
+ * @brief Multi-rate periodic executive with absolute release times
+ *
+ * Each task is released on a fixed grid: release n is start + offset +
+ * n * period, computed from the previous release rather than from when
+ * the previous run finished, so execution time and wake-up latency never
+ * accumulate into drift. Due tasks run to completion in rate-monotonic
+ * order (shortest period first); the caller sleeps until nextRelease()
+ * between calls to runDue().
+ *
+ * A run that finishes after its implicit deadline (the next release)
+ * counts as an overrun. Releases whose whole window has already passed
+ * when a run finishes are skipped and counted, so an overloaded task
+ * does not run back to back to catch up; it stays on its grid.
+ */
+
+#include "CycleProfiler.hpp"
+#include <cstddef>
+#include <cstdint>
+
+#ifdef SIMULATION_BUILD
+    #include <time.h>
+#else
+    #include <zephyr.h>
+#endif
+
+class PeriodicScheduler {
+public:
+    static constexpr size_t kMaxTasks = 8;
+
+    /**
+     * @param context Pointer given to add()
+     * @param release_us This run's release time (on the task's grid)
+     */
+    using TaskFn = void (*)(void* context, uint64_t release_us);
+    using ClockFn = uint64_t (*)(void* context);
+
+    struct TaskStats {
+        uint32_t runs = 0;
+        uint32_t overruns = 0;          // Finished after the next release
+        uint32_t skipped = 0;           // Releases dropped after an overrun
+        uint32_t max_exec_us = 0;
+        LatencyHistogram latency_us;    // Start minus release: the jitter
+    };
+
+    /**
+     * @param clock Monotonic microseconds; defaults to the platform clock
+     */
+    explicit PeriodicScheduler(ClockFn clock = &monotonicUs, void* clock_context = nullptr)
+        : clock_(clock), clock_context_(clock_context) {}
+
+    static uint64_t monotonicUs(void*) {
+#ifdef SIMULATION_BUILD
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000u + static_cast<uint64_t>(ts.tv_nsec) / 1000u;
+#else
+        return k_ticks_to_us_floor64(k_uptime_ticks());
+#endif
+    }
+
+    /**
+     * @brief Register a task; call before start()
+     * @param offset_us First release relative to start(), to spread tasks apart
+     * @return Task id, or -1 if the table is full or the period is zero
+     */
+    int add(const char* name, uint32_t period_us, TaskFn fn, void* context, uint32_t offset_us = 0) {
+        if (count_ == kMaxTasks || period_us == 0 || fn == nullptr) return -1;
+        int id = static_cast<int>(count_);
+        Task& task = tasks_[id];
+        task.name = name;
+        task.period_us = period_us;
+        task.offset_us = offset_us;
+        task.fn = fn;
+        task.context = context;
+
+        // Keep order_ sorted by period; equal periods run in registration order
+        size_t pos = count_;
+        while (pos > 0 && tasks_[order_[pos - 1]].period_us > period_us) {
+            order_[pos] = order_[pos - 1];
+            pos--;
+        }
+        order_[pos] = static_cast<uint8_t>(id);
+        count_++;
+        return id;
+    }
+
+    /**
+     * @brief Put every task on its grid, starting at @p start_us
+     */
+    void start(uint64_t start_us) {
+        for (size_t i = 0; i < count_; i++) {
+            tasks_[i].next_release_us = start_us + tasks_[i].offset_us;
+        }
+    }
+
+    void start() { start(clock_(clock_context_)); }
+
+    /**
+     * @brief Run every released task, highest rate first
+     *
+     * The clock is re-read after each run, so a fast task released while
+     * a slow one was running goes before the remaining slower ones. Each
+     * task runs at most once per call, so one that overruns every period
+     * cannot starve the others.
+     * @return Number of runs
+     */
+    size_t runDue() {
+        size_t runs = 0;
+        uint32_t ran = 0;
+        while (true) {
+            uint64_t now = clock_(clock_context_);
+            Task* task = nullptr;
+            for (size_t i = 0; i < count_; i++) {
+                Task& candidate = tasks_[order_[i]];
+                if (candidate.next_release_us <= now && !(ran & (1u << order_[i]))) {
+                    task = &candidate;
+                    ran |= 1u << order_[i];
+                    break;
+                }
+            }
+            if (task == nullptr) return runs;
+
+            uint64_t release = task->next_release_us;
+            uint64_t deadline = release + task->period_us;
+            task->stats.latency_us.record(saturate(now - release));
+
+            running_ = task;
+            task->fn(task->context, release);
+            running_ = nullptr;
+
+            uint64_t done = clock_(clock_context_);
+            uint32_t exec = saturate(done - now);
+            if (exec > task->stats.max_exec_us) task->stats.max_exec_us = exec;
+            task->stats.runs++;
+            if (done > deadline) task->stats.overruns++;
+
+            // period_us may have been changed by the task itself
+            task->next_release_us = release + task->period_us;
+            if (done >= task->next_release_us + task->period_us) {
+                uint64_t missed = (done - task->next_release_us) / task->period_us;
+                task->next_release_us += missed * task->period_us;
+                task->stats.skipped += static_cast<uint32_t>(missed);
+            }
+            runs++;
+        }
+    }
+
+    /**
+     * @brief Earliest pending release: sleep until then (absolute time)
+     */
+    uint64_t nextRelease() const {
+        uint64_t next = UINT64_MAX;
+        for (size_t i = 0; i < count_; i++) {
+            if (tasks_[i].next_release_us < next) next = tasks_[i].next_release_us;
+        }
+        return next;
+    }
+
+    /**
+     * @brief Change a task's period from its last release on
+     *
+     * For rate adaptation (e.g. AdaptiveSampler): the grid re-phases to
+     * last release + new period, so a change never adds drift either.
+     * Rate-monotonic order is fixed at add() and not revisited.
+     */
+    void setPeriod(int id, uint32_t period_us) {
+        if (id < 0 || static_cast<size_t>(id) >= count_ || period_us == 0) return;
+        Task& task = tasks_[id];
+        if (&task != running_) {
+            task.next_release_us = task.next_release_us - task.period_us + period_us;
+        }
+        task.period_us = period_us;
+    }
+
+    uint32_t period(int id) const { return tasks_[id].period_us; }
+    const char* name(int id) const { return tasks_[id].name; }
+    uint64_t nextRelease(int id) const { return tasks_[id].next_release_us; }
+    const TaskStats& getStats(int id) const { return tasks_[id].stats; }
+    size_t size() const { return count_; }
+
+private:
+    struct Task {
+        const char* name = nullptr;
+        uint32_t period_us = 0;
+        uint32_t offset_us = 0;
+        TaskFn fn = nullptr;
+        void* context = nullptr;
+        uint64_t next_release_us = 0;
+        TaskStats stats;
+    };
+
+    static uint32_t saturate(uint64_t us) {
+        return us > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(us);
+    }
+
+    ClockFn clock_;
+    void* clock_context_;
+    Task tasks_[kMaxTasks];
+    uint8_t order_[kMaxTasks] = {};    // Task ids by ascending period
+    size_t count_ = 0;
+    Task* running_ = nullptr;
+};
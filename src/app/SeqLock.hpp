@@ -0,0 +1,232 @@
+#pragma once
+
+/**
+ * @file SeqLock.hpp
+ * @brief Sequence-locked value for lock-free publication between threads
+ *
+ * Writers publish a complete new value; readers get either the previous or
+ * the new value, never a mix. The sequence counter is odd while a write is
+ * in progress: readers that see an odd or changed sequence discard their
+ * copy. Readers never block writers and tryRead() never waits at all, so a
+ * control loop can poll for updates at its cycle boundary.
+ *
+ * The payload is stored as atomic words rather than a plain T, so the racy
+ * read a seqlock relies on is well defined in C++. Word stores are release
+ * and word loads acquire instead of relaxed accesses plus fences: on x86
+ * they compile to the same plain moves, and ThreadSanitizer (which does not
+ * model standalone fences) can verify them. Concurrent writers are
+ * serialized by a mutex (priority-inheriting k_mutex on Zephyr), so a
+ * higher-priority writer sleeps instead of spinning on a preempted one.
+ * The writer holding it then claims the odd sequence with a compare-and-
+ * swap, the only step tryWrite() takes, so a loop that must not block
+ * can still publish.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#ifdef SIMULATION_BUILD
+    #include <mutex>
+    #include <thread>
+#else
+    #include <zephyr.h>
+#endif
+
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock payload must be trivially copyable");
+
+public:
+    SeqLock() : SeqLock(T{}) {}
+
+    explicit SeqLock(const T& initial) {
+#ifndef SIMULATION_BUILD
+        k_mutex_init(&writer_mutex_);
+#endif
+        storeWords(initial);
+    }
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    /**
+     * @brief Publish a new value (waits only for other writers)
+     */
+    void write(const T& value) {
+        lockWriters();
+        uint32_t seq = lockWriter();
+        storeWords(value);
+        sequence_.store(seq + 2, std::memory_order_release);
+        unlockWriters();
+    }
+
+    /**
+     * @brief Publish from the only thread that ever writes this value
+     *
+     * Skips the writer compare-and-swap (a locked instruction costing more
+     * than the payload stores). Must not be mixed with concurrent write()
+     * or update() calls.
+     */
+    void writeExclusive(const T& value) {
+        uint32_t seq = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(seq + 1, std::memory_order_relaxed);
+        storeWords(value);
+        sequence_.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Publish only if nothing was written since @p expected; never waits
+     *
+     * For a thread that must not block, such as the control loop: derive
+     * @p value from a tryRead() at version @p expected, then publish it
+     * unless another writer holds the lock or has published since.
+     * @return false if another write is in progress or completed meanwhile
+     */
+    bool tryWrite(const T& value, uint32_t expected) {
+        if (expected & 1u) return false;
+        if (!sequence_.compare_exchange_strong(expected, expected + 1, std::memory_order_acquire,
+                                               std::memory_order_relaxed)) {
+            return false;
+        }
+        storeWords(value);
+        sequence_.store(expected + 2, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Modify the current value in place under the writer lock
+     * @param modify Callable taking T&; read-modify-write is atomic with
+     *               respect to other writers
+     */
+    template <typename Fn>
+    void update(Fn&& modify) {
+        lockWriters();
+        uint32_t seq = lockWriter();
+        T value = loadWords();
+        modify(value);
+        storeWords(value);
+        sequence_.store(seq + 2, std::memory_order_release);
+        unlockWriters();
+    }
+
+    /**
+     * @brief Single read attempt, never waits
+     * @param out Receives the value on success; untouched otherwise
+     * @param version Optional: receives the version that was read
+     * @return false if a write was in progress or completed during the read
+     */
+    bool tryRead(T& out, uint32_t* version = nullptr) const {
+        uint32_t before = sequence_.load(std::memory_order_acquire);
+        if (before & 1u) return false;
+        // Acquire word loads keep this re-check after them; seeing any word
+        // of a newer write implies seeing at least its odd sequence
+        T value = loadWords();
+        uint32_t after = sequence_.load(std::memory_order_relaxed);
+        if (before != after) return false;
+        out = value;
+        if (version) *version = before;
+        return true;
+    }
+
+    /**
+     * @brief Read a consistent value, retrying while writes interfere
+     *
+     * Yields after a short spin: on a single core, a reader that keeps
+     * failing has preempted a writer mid-publish and only delays it.
+     */
+    T read() const {
+        T value;
+        for (unsigned attempt = 1; !tryRead(value); ++attempt) {
+            if (attempt % kSpinsBeforeYield == 0) yieldThread();
+        }
+        return value;
+    }
+
+    static void yieldThread() {
+#ifdef SIMULATION_BUILD
+        std::this_thread::yield();
+#else
+        k_yield();
+#endif
+    }
+
+    /**
+     * @brief Even version number of the latest completed write (odd while
+     *        a write is in progress); cheap change detection for pollers
+     */
+    uint32_t version() const {
+        return sequence_.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr size_t kWords = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+    static constexpr unsigned kSpinsBeforeYield = 64;
+
+    void lockWriters() {
+#ifdef SIMULATION_BUILD
+        writer_mutex_.lock();
+#else
+        k_mutex_lock(&writer_mutex_, K_FOREVER);
+#endif
+    }
+
+    void unlockWriters() {
+#ifdef SIMULATION_BUILD
+        writer_mutex_.unlock();
+#else
+        k_mutex_unlock(&writer_mutex_);
+#endif
+    }
+
+    /**
+     * @brief Claim the odd sequence; called with the writer mutex held
+     *
+     * The only contender left is a tryWrite(), which never waits, so this
+     * rarely loops; it yields like read() in case it preempted one.
+     */
+    uint32_t lockWriter() {
+        uint32_t seq = sequence_.load(std::memory_order_relaxed);
+        for (unsigned attempt = 1;; ++attempt) {
+            if ((seq & 1u) == 0 &&
+                sequence_.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire,
+                                                std::memory_order_relaxed)) {
+                return seq;
+            }
+            if (attempt % kSpinsBeforeYield == 0) yieldThread();
+            seq = sequence_.load(std::memory_order_relaxed);
+        }
+    }
+
+    void storeWords(const T& value) {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+        for (size_t i = 0; i < kWords; i++) {
+            uint32_t word = 0;
+            size_t offset = i * sizeof(uint32_t);
+            memcpy(&word, bytes + offset,
+                   sizeof(T) - offset < sizeof(uint32_t) ? sizeof(T) - offset : sizeof(uint32_t));
+            // Release: the odd sequence is visible before this word
+            words_[i].store(word, std::memory_order_release);
+        }
+    }
+
+    T loadWords() const {
+        uint32_t words[kWords];
+        for (size_t i = 0; i < kWords; i++) {
+            words[i] = words_[i].load(std::memory_order_acquire);
+        }
+        T value;
+        memcpy(&value, words, sizeof(T));
+        return value;
+    }
+
+    std::atomic<uint32_t> sequence_{0};
+    std::atomic<uint32_t> words_[kWords];
+#ifdef SIMULATION_BUILD
+    std::mutex writer_mutex_;
+#else
+    struct k_mutex writer_mutex_;
+#endif
+};
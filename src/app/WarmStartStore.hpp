@@ -0,0 +1,197 @@
+#pragma once
+
+/**
+ * @file WarmStartStore.hpp
+ * @brief Persists PID configuration and integral so a reboot resumes control
+ *
+ * The record is small (44 bytes), versioned and CRC-checked; anything that
+ * fails validation is ignored and the controller cold-starts as before.
+ *
+ * Flash has limited erase cycles, so saves are coalesced:
+ *   - identical records are never written;
+ *   - setpoint changes are written once they have been quiet for
+ *     config_delay seconds, so a burst of adjustments costs one write;
+ *   - gain and limit changes (operator tuning or the controller's own
+ *     adaptation) are written at most every min_interval seconds, and only
+ *     if some value moved by gain_threshold relative to the saved one;
+ *   - integral drift is written at most every min_interval seconds, and
+ *     only if it moved by integral_threshold;
+ *   - any other difference is written after max_interval seconds.
+ */
+
+#include "drivers.hpp"
+#include "PIDController.hpp"
+#include "Crc.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+class WarmStartStore {
+public:
+    static constexpr uint16_t kMagic = 0x5357;     // "WS"
+    static constexpr uint8_t kVersion = 1;
+
+    struct Record {
+        uint16_t magic;
+        uint8_t version;
+        uint8_t size;
+        PIDController::Config config;
+        float integral;
+        float output;
+        uint32_t crc;                // CRC-32 of every byte before it
+    };
+    static_assert(sizeof(Record) == 44, "record layout is stored in flash");
+
+    struct Policy {
+        float config_delay = 10.0f;        // Quiet time before saving a setpoint change (s)
+        float min_interval = 300.0f;       // Minimum spacing of gain and integral saves (s)
+        float gain_threshold = 0.1f;       // Relative gain/limit change worth a save
+        float integral_threshold = 5.0f;   // Integral change worth a save (°C·s)
+        float max_interval = 3600.0f;      // Save any remaining difference this often (s)
+    };
+
+    struct Stats {
+        uint32_t writes = 0;
+        uint32_t failed_writes = 0;
+        uint32_t deferred = 0;             // Cycles with unsaved changes not yet due
+    };
+
+    explicit WarmStartStore(SettingsDriver& settings, const char* key = "tempctrl/pid")
+        : settings_(settings), key_(key) {}
+
+    WarmStartStore(SettingsDriver& settings, const char* key, const Policy& policy)
+        : settings_(settings), key_(key), policy_(policy) {}
+
+    /**
+     * @brief Load and validate the stored record
+     * @return false if missing, truncated, from another version or corrupt
+     */
+    bool load(PIDController::Config& config, float& integral, float& output) {
+        Record record;
+        if (settings_.load(key_, &record, sizeof(record)) != sizeof(record)) return false;
+        if (!valid(record)) return false;
+        config = record.config;
+        integral = record.integral;
+        output = record.output;
+        saved_ = record;
+        has_saved_ = true;
+        return true;
+    }
+
+    /**
+     * @brief Offer the current state; writes only when the policy says so
+     * @param dt Time since the previous call in seconds
+     * @return true if a record was written
+     */
+    bool update(const PIDController::Config& config, const PIDController::State& state, float dt) {
+        since_write_ += dt;
+        if (!has_saved_) return since_write_ >= 0.0f && save(config, state);
+
+        bool setpoint_changed = config.setpoint != saved_.config.setpoint;
+        if (setpoint_changed) {
+            if (config.setpoint != pending_setpoint_) {
+                pending_setpoint_ = config.setpoint;
+                setpoint_quiet_ = 0.0f;
+            } else {
+                setpoint_quiet_ += dt;
+            }
+            if (setpoint_quiet_ >= policy_.config_delay) return save(config, state);
+        }
+
+        float tuning = tuningChange(config, saved_.config);
+        bool tuning_due = tuning >= policy_.gain_threshold && since_write_ >= policy_.min_interval;
+        float drift = std::fabs(state.integral - saved_.integral);
+        bool integral_due = drift >= policy_.integral_threshold && since_write_ >= policy_.min_interval;
+        bool differs = setpoint_changed || tuning > 0.0f || state.integral != saved_.integral;
+        if (tuning_due || integral_due || (differs && since_write_ >= policy_.max_interval)) {
+            return save(config, state);
+        }
+        if (differs) stats_.deferred++;
+        return false;
+    }
+
+    /**
+     * @brief Write now unless the stored record is already identical
+     *        (planned shutdown, explicit "save settings" command)
+     */
+    bool flush(const PIDController::Config& config, const PIDController::State& state) {
+        Record record = makeRecord(config, state);
+        if (has_saved_ && memcmp(&record, &saved_, sizeof(record)) == 0) return true;
+        return write(record);
+    }
+
+    const Stats& getStats() const { return stats_; }
+
+    static bool valid(const Record& record) {
+        if (record.magic != kMagic || record.version != kVersion || record.size != sizeof(Record)) {
+            return false;
+        }
+        if (record.crc != crc::crc32(&record, offsetof(Record, crc))) return false;
+        const PIDController::Config& c = record.config;
+        return std::isfinite(record.integral) && std::isfinite(record.output) &&
+               std::isfinite(c.setpoint) && c.output_min < c.output_max && c.integral_max >= 0.0f;
+    }
+
+    static Record makeRecord(const PIDController::Config& config, const PIDController::State& state) {
+        Record record{};                // No padding (size asserted), so CRC and compare see only fields
+        record.magic = kMagic;
+        record.version = kVersion;
+        record.size = sizeof(Record);
+        record.config = config;
+        record.integral = state.integral;
+        record.output = state.output;
+        record.crc = crc::crc32(&record, offsetof(Record, crc));
+        return record;
+    }
+
+private:
+    /**
+     * @brief Largest relative change of a gain or limit (setpoint excluded)
+     */
+    static float tuningChange(const PIDController::Config& a, const PIDController::Config& b) {
+        const float pairs[][2] = {{a.kp, b.kp}, {a.ki, b.ki}, {a.kd, b.kd}, {a.output_min, b.output_min},
+                                  {a.output_max, b.output_max}, {a.integral_max, b.integral_max}};
+        float change = 0.0f;
+        for (const auto& pair : pairs) {
+            float scale = std::max(std::fabs(pair[0]), std::fabs(pair[1]));
+            if (scale > 0.0f) change = std::max(change, std::fabs(pair[0] - pair[1]) / scale);
+        }
+        return change;
+    }
+
+    bool save(const PIDController::Config& config, const PIDController::State& state) {
+        Record record = makeRecord(config, state);
+        if (has_saved_ && memcmp(&record, &saved_, sizeof(record)) == 0) {
+            since_write_ = 0.0f;
+            return false;
+        }
+        return write(record);
+    }
+
+    bool write(const Record& record) {
+        if (!settings_.save(key_, &record, sizeof(record))) {
+            // Back off for config_delay before any retry
+            stats_.failed_writes++;
+            since_write_ = -policy_.config_delay;
+            setpoint_quiet_ = 0.0f;
+            return false;
+        }
+        saved_ = record;
+        has_saved_ = true;
+        pending_setpoint_ = record.config.setpoint;
+        setpoint_quiet_ = 0.0f;
+        since_write_ = 0.0f;
+        stats_.writes++;
+        return true;
+    }
+
+    SettingsDriver& settings_;
+    const char* key_;
+    Policy policy_;
+    Record saved_{};
+    bool has_saved_ = false;
+    float pending_setpoint_ = 0.0f;
+    float setpoint_quiet_ = 0.0f;
+    float since_write_ = 0.0f;
+    Stats stats_;
+};
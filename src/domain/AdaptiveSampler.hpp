@@ -0,0 +1,103 @@
+#pragma once
+
+/**
+ * @file AdaptiveSampler.hpp
+ * @brief Sampling-period scheduler driven by temperature rate of change
+ *
+ * Chooses the next control period so that each sample sees roughly the
+ * same temperature change: short periods during thermal transients or
+ * when the control error is large, long (tickless) sleeps when stable.
+ * Periods shrink immediately but grow gradually to avoid oscillating
+ * between the bounds.
+ */
+
+#include <algorithm>
+#include <cstdint>
+
+class AdaptiveSampler {
+public:
+    /**
+     * @brief Scheduler bounds and sensitivity
+     */
+    struct Config {
+        uint32_t min_period_ms = 250;      // Fastest sampling during transients
+        uint32_t max_period_ms = 5000;     // Slowest sampling when stable
+        uint32_t initial_period_ms = 1000; // Period before a rate estimate exists
+        float target_delta = 0.1f;         // Desired temperature change per sample (°C)
+        float error_threshold = 0.5f;      // |error| (°C) above which the minimum period is used
+        float growth_limit = 1.5f;         // Maximum period increase per step
+    };
+
+private:
+    Config config_;
+    uint32_t period_ms_;
+    float last_temp_ = 0.0f;
+    float rate_ = 0.0f;
+    bool has_sample_ = false;
+
+public:
+    AdaptiveSampler() : AdaptiveSampler(Config{}) {}
+    explicit AdaptiveSampler(const Config& config)
+        : config_(config), period_ms_(config.initial_period_ms) {}
+
+    /**
+     * @brief Compute the next sampling period
+     * @param temperature Latest temperature reading (°C)
+     * @param error Latest control error (°C)
+     * @param dt_s Actual time since the previous reading (s)
+     * @return Period to sleep before the next reading (ms)
+     */
+    uint32_t next(float temperature, float error, float dt_s) {
+        if (has_sample_ && dt_s > 0.0f) {
+            rate_ = (temperature - last_temp_) / dt_s;
+        }
+        last_temp_ = temperature;
+        has_sample_ = true;
+
+        float abs_error = error < 0.0f ? -error : error;
+        float abs_rate = rate_ < 0.0f ? -rate_ : rate_;
+
+        float wanted_ms;
+        if (abs_error >= config_.error_threshold) {
+            wanted_ms = static_cast<float>(config_.min_period_ms);
+        } else if (abs_rate > 0.0f) {
+            wanted_ms = config_.target_delta / abs_rate * 1000.0f;
+        } else {
+            wanted_ms = static_cast<float>(config_.max_period_ms);
+        }
+
+        // Shrink at once, grow gradually
+        float grown = period_ms_ * config_.growth_limit;
+        wanted_ms = std::min(wanted_ms, grown);
+        wanted_ms = std::max(static_cast<float>(config_.min_period_ms),
+                             std::min(static_cast<float>(config_.max_period_ms), wanted_ms));
+
+        period_ms_ = static_cast<uint32_t>(wanted_ms);
+        return period_ms_;
+    }
+
+    /**
+     * @brief Get the most recently chosen period
+     * @return Period in milliseconds
+     */
+    uint32_t getPeriodMs() const {
+        return period_ms_;
+    }
+
+    /**
+     * @brief Get the estimated temperature rate of change
+     * @return Rate in °C per second
+     */
+    float getRate() const {
+        return rate_;
+    }
+
+    /**
+     * @brief Forget rate history and return to the initial period
+     */
+    void reset() {
+        period_ms_ = config_.initial_period_ms;
+        rate_ = 0.0f;
+        has_sample_ = false;
+    }
+};
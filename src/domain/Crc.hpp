@@ -0,0 +1,77 @@
+#pragma once
+
+/**
+ * @file Crc.hpp
+ * @brief Table-driven CRCs: CRC-32 (IEEE 802.3, as in zlib) for stored
+ *        records, CRC-16/CCITT-FALSE for serial frames
+ *
+ * The tables are built at compile time and live in flash.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crc {
+
+struct Crc32Table {
+    uint32_t entries[256];
+};
+
+constexpr Crc32Table buildCrc32Table() {
+    Crc32Table table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            c = (c & 1u) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        }
+        table.entries[i] = c;
+    }
+    return table;
+}
+
+inline constexpr Crc32Table kCrc32Table = buildCrc32Table();
+
+/**
+ * @brief CRC-32 of @p size bytes; pass a previous result as @p crc to continue
+ */
+inline uint32_t crc32(const void* data, size_t size, uint32_t crc = 0) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i) {
+        crc = kCrc32Table.entries[(crc ^ bytes[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+struct Crc16Table {
+    uint16_t entries[256];
+};
+
+constexpr Crc16Table buildCrc16Table() {
+    Crc16Table table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint16_t c = static_cast<uint16_t>(i << 8);
+        for (int bit = 0; bit < 8; ++bit) {
+            c = static_cast<uint16_t>((c & 0x8000u) ? (c << 1) ^ 0x1021u : c << 1);
+        }
+        table.entries[i] = c;
+    }
+    return table;
+}
+
+inline constexpr Crc16Table kCrc16Table = buildCrc16Table();
+
+constexpr uint16_t kCrc16Init = 0xFFFF;
+
+/**
+ * @brief CRC-16/CCITT-FALSE; pass a previous result as @p crc to continue
+ */
+inline uint16_t crc16(const void* data, size_t size, uint16_t crc = kCrc16Init) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        crc = static_cast<uint16_t>((crc << 8) ^ kCrc16Table.entries[((crc >> 8) ^ bytes[i]) & 0xFFu]);
+    }
+    return crc;
+}
+
+} // namespace crc
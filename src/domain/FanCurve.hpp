@@ -0,0 +1,41 @@
+#pragma once
+
+/**
+ * @file FanCurve.hpp
+ * @brief Duty-cycle to airflow models for supported fan types
+ *
+ * A fan model is a policy struct with a constexpr `airflow(duty)` that is
+ * monotonically non-decreasing over 0-100%. Models are used both by
+ * VariableFan for monitoring and by FanLinearizer to build inverse tables.
+ */
+
+/**
+ * @brief Default fan: 5% start-up dead zone, quadratic above it
+ */
+struct QuadraticFanCurve {
+    static constexpr float dead_zone = 5.0f;
+
+    static constexpr float airflow(float duty) {
+        if (duty < dead_zone) return 0.0f;
+        float effective = (duty - dead_zone) / (100.0f - dead_zone);
+        return effective * effective * 100.0f;
+    }
+};
+
+/**
+ * @brief Fan with a higher stall threshold and a softer 1.5-power curve
+ */
+struct HighStartFanCurve {
+    static constexpr float dead_zone = 20.0f;
+
+    static constexpr float airflow(float duty) {
+        if (duty < dead_zone) return 0.0f;
+        float effective = (duty - dead_zone) / (100.0f - dead_zone);
+        // effective^1.5 without std::pow so the model stays constexpr
+        float root = effective;
+        for (int i = 0; i < 8; i++) {
+            root = 0.5f * (root + effective / (root > 0.0f ? root : 1.0f));
+        }
+        return effective * root * 100.0f;
+    }
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+/**
+ * @file FanLinearizer.hpp
+ * @brief Inverse fan-curve lookup for linear airflow control
+ *
+ * Maps a requested airflow (0-100%) to the duty cycle that produces it, so
+ * the PID controller sees an approximately linear actuator. The inverse
+ * table is generated at compile time from the fan model by bisection and
+ * evaluated at run time with one index computation and one interpolation.
+ */
+
+#include "FanCurve.hpp"
+#include <cstddef>
+
+template <typename Curve, std::size_t Points = 65>
+class FanLinearizer {
+    static_assert(Points >= 2, "table needs at least two points");
+
+public:
+    struct Table {
+        float duty[Points];
+    };
+
+    /**
+     * @brief Build the inverse table: entry i holds the largest duty whose
+     *        airflow does not exceed i / (Points - 1) * 100%
+     */
+    static constexpr Table build() {
+        Table table{};
+        for (std::size_t i = 0; i < Points; ++i) {
+            float target = 100.0f * i / (Points - 1);
+            float lo = 0.0f;
+            float hi = 100.0f;
+            for (int iter = 0; iter < 32; ++iter) {
+                float mid = 0.5f * (lo + hi);
+                if (Curve::airflow(mid) <= target) lo = mid;
+                else hi = mid;
+            }
+            table.duty[i] = lo;
+        }
+        table.duty[Points - 1] = 100.0f;
+        return table;
+    }
+
+    static constexpr Table table = build();
+
+    /**
+     * @brief Convert requested airflow to duty cycle
+     * @param airflow Requested airflow percentage (0-100)
+     * @return Duty cycle percentage; 0 when no airflow is requested
+     */
+    static float dutyFor(float airflow) {
+        if (airflow <= 0.0f) return 0.0f;
+        if (airflow >= 100.0f) return 100.0f;
+
+        constexpr float scale = (Points - 1) / 100.0f;
+        float position = airflow * scale;
+        std::size_t index = static_cast<std::size_t>(position);
+        float fraction = position - index;
+        return table.duty[index] + fraction * (table.duty[index + 1] - table.duty[index]);
+    }
+};
@@ -0,0 +1,190 @@
+#pragma once
+
+/**
+ * @file NtcThermistor.hpp
+ * @brief NTC thermistor calibration through compile-time lookup tables
+ *
+ * A thermistor is described by a divider policy (how the ADC code maps to
+ * resistance) and an equation policy (Beta or Steinhart-Hart: resistance
+ * to temperature). NtcTable samples the exact curve at compile time at
+ * evenly spaced ADC codes. At run time a conversion costs one shift, one
+ * mask and one interpolation, with no log() per sample.
+ *
+ * The table error is largest at the extremes of the ADC range, where the
+ * curve is steepest. maxError() evaluates it exactly, at compile time
+ * if desired, over a temperature band, so a board can static_assert its
+ * accuracy budget.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ntc {
+
+/**
+ * @brief Natural logarithm usable in constant expressions
+ *
+ * Reduces x to m * 2^k with m in [1, 2), then sums the atanh series
+ * ln(m) = 2 * (z + z^3/3 + z^5/5 + ...), z = (m - 1) / (m + 1) <= 1/3.
+ */
+constexpr double ln(double x) {
+    if (x <= 0.0) return -1e300;
+    constexpr double ln2 = 0.69314718055994530942;
+    int k = 0;
+    while (x >= 2.0) { x *= 0.5; ++k; }
+    while (x < 1.0) { x *= 2.0; --k; }
+    double z = (x - 1.0) / (x + 1.0);
+    double z2 = z * z;
+    double term = z;
+    double sum = 0.0;
+    for (int n = 1; n < 60; n += 2) {
+        sum += term / n;
+        term *= z2;
+    }
+    return 2.0 * sum + k * ln2;
+}
+
+constexpr double kKelvinOffset = 273.15;
+
+/**
+ * @brief Beta-parameter equation: 1/T = 1/T0 + ln(R/R0) / Beta
+ *
+ * Params provides r_nominal (ohms at t_nominal), t_nominal (°C) and beta (K).
+ */
+template <typename Params>
+struct BetaEquation {
+    static constexpr double celsius(double resistance) {
+        double inv_t = 1.0 / (Params::t_nominal + kKelvinOffset) +
+                       ln(resistance / Params::r_nominal) / Params::beta;
+        return 1.0 / inv_t - kKelvinOffset;
+    }
+};
+
+/**
+ * @brief Steinhart-Hart equation: 1/T = A + B ln(R) + C ln(R)^3
+ *
+ * Params provides the fitted coefficients a, b and c.
+ */
+template <typename Params>
+struct SteinhartHartEquation {
+    static constexpr double celsius(double resistance) {
+        double l = ln(resistance);
+        return 1.0 / (Params::a + Params::b * l + Params::c * l * l * l) - kKelvinOffset;
+    }
+};
+
+/**
+ * @brief Thermistor on the low side of a divider to the ADC reference
+ *
+ * R_ntc = R_series * code / (full_scale - code). Params provides
+ * series_resistance (ohms) and adc_bits.
+ */
+template <typename Params>
+struct LowSideDivider {
+    static constexpr uint32_t kCodes = 1u << Params::adc_bits;
+
+    static constexpr double resistance(double code) {
+        return Params::series_resistance * code / (kCodes - code);
+    }
+};
+
+} // namespace ntc
+
+/**
+ * @brief Piecewise-linear ADC-code to °C table for one thermistor circuit
+ * @tparam Equation ntc::BetaEquation or ntc::SteinhartHartEquation
+ * @tparam Divider ntc::LowSideDivider (or any policy with kCodes and resistance())
+ * @tparam Segments Table segments, a power of two
+ */
+template <typename Equation, typename Divider, std::size_t Segments = 128>
+class NtcTable {
+    static_assert(Segments >= 2 && (Segments & (Segments - 1)) == 0, "segments must be a power of two");
+    static_assert(Divider::kCodes % Segments == 0, "segments must divide the ADC range");
+
+public:
+    static constexpr uint32_t kCodes = Divider::kCodes;
+    static constexpr uint32_t kStep = kCodes / Segments;
+    static constexpr unsigned kShift = __builtin_ctz(kStep);
+
+    struct Table {
+        float celsius[Segments + 1];
+    };
+
+    /**
+     * @brief Exact temperature for an ADC code, clamped away from the rails
+     */
+    static constexpr double exact(double code) {
+        if (code < 0.5) code = 0.5;
+        if (code > kCodes - 0.5) code = kCodes - 0.5;
+        return Equation::celsius(Divider::resistance(code));
+    }
+
+    static constexpr Table build() {
+        Table table{};
+        for (std::size_t i = 0; i <= Segments; ++i) {
+            table.celsius[i] = static_cast<float>(exact(static_cast<double>(i * kStep)));
+        }
+        return table;
+    }
+
+    static constexpr Table table = build();
+
+    /**
+     * @brief Convert an ADC code to °C
+     * @param raw ADC code (0 to kCodes - 1)
+     */
+    static float toCelsius(uint16_t raw) {
+        uint32_t code = raw < kCodes ? raw : kCodes - 1;
+        uint32_t index = code >> kShift;
+        float fraction = (code & (kStep - 1)) * (1.0f / kStep);
+        return table.celsius[index] + fraction * (table.celsius[index + 1] - table.celsius[index]);
+    }
+
+    /**
+     * @brief Interpolated value at @p code, evaluable at compile time
+     */
+    static constexpr double interpolated(uint32_t code) {
+        uint32_t index = code / kStep;
+        double fraction = static_cast<double>(code % kStep) / kStep;
+        return table.celsius[index] + fraction * (table.celsius[index + 1] - table.celsius[index]);
+    }
+
+    /**
+     * @brief Largest |table - exact| over all codes whose exact temperature
+     *        lies in [min_celsius, max_celsius]
+     */
+    static constexpr double maxError(double min_celsius, double max_celsius) {
+        double worst = 0.0;
+        for (uint32_t code = 1; code < kCodes; ++code) {
+            double truth = exact(code);
+            if (truth < min_celsius || truth > max_celsius) continue;
+            double error = interpolated(code) - truth;
+            if (error < 0.0) error = -error;
+            if (error > worst) worst = error;
+        }
+        return worst;
+    }
+};
+
+/**
+ * @brief Thermistors and dividers used on our boards
+ */
+struct Ntc10kB3950 {
+    static constexpr double r_nominal = 10000.0;
+    static constexpr double t_nominal = 25.0;
+    static constexpr double beta = 3950.0;
+};
+
+// Generic 10 kOhm NTC, Steinhart-Hart fit over -40..125 °C
+struct Ntc10kSteinhartHart {
+    static constexpr double a = 1.129148e-3;
+    static constexpr double b = 2.34125e-4;
+    static constexpr double c = 8.76741e-8;
+};
+
+struct Divider10k12Bit {
+    static constexpr double series_resistance = 10000.0;
+    static constexpr unsigned adc_bits = 12;
+};
+
+using Ntc10kTable = NtcTable<ntc::BetaEquation<Ntc10kB3950>, ntc::LowSideDivider<Divider10k12Bit>>;
@@ -39,6 +39,7 @@ public:
         float i_term = 0.0f;          // Integral component  
         float d_term = 0.0f;          // Derivative component
         uint32_t update_count = 0;    // Number of updates performed
+        float held_time = 0.0f;       // Time integrated by hold() since last update
         bool first_run = true;        // Flag for first execution
     };
 
@@ -64,6 +65,16 @@ public:
      * @return Control output (0-100% fan speed)
      */
     float update(float input) {
+        return update(input, 1.0f);
+    }
+
+    /**
+     * @brief Update PID controller after an arbitrary interval
+     * @param input Current temperature reading (°C)
+     * @param dt Time since the previous sample in seconds (1.0 = nominal period)
+     * @return Control output (0-100% fan speed)
+     */
+    float update(float input, float dt) {
         // Calculate error (negative = too hot, positive = too cool)
         state_.error = config_.setpoint - input;
 
@@ -71,35 +82,59 @@ public:
         state_.p_term = config_.kp * state_.error;
 
         // Integral term (with anti-windup)
-        state_.integral += state_.error;
-        // Prevent integral windup
-        state_.integral = std::max(-config_.integral_max, 
-                                 std::min(config_.integral_max, state_.integral));
+        integrate(state_.error, dt);
         state_.i_term = config_.ki * state_.integral;
 
-        // Derivative term (skip on first run)
+        // Derivative term (skip on first run); spans any held cycles
         if (!state_.first_run) {
-            state_.derivative = state_.error - state_.error_prev;
+            state_.derivative = (state_.error - state_.error_prev) / (dt + state_.held_time);
             state_.d_term = config_.kd * state_.derivative;
         } else {
             state_.derivative = 0.0f;
             state_.d_term = 0.0f;
             state_.first_run = false;
         }
+        state_.held_time = 0.0f;
 
-        // Calculate total output (invert for cooling applications)
-        // When error is negative (too hot), we want positive output (fan speed)
-        state_.output = -(state_.p_term + state_.i_term + state_.d_term);
-
-        // Clamp output to valid range
-        state_.output = std::max(config_.output_min, 
-                               std::min(config_.output_max, state_.output));
+        return finishUpdate();
+    }
 
-        // Store error for next derivative calculation
-        state_.error_prev = state_.error;
-        state_.update_count++;
+    /**
+     * @brief Update with a measured rate of change instead of differencing
+     *
+     * For inputs that come with their own slope estimate (e.g.
+     * TemperatureEstimator): the derivative term uses -rate directly, so
+     * it has no first-cycle gap and no noise from two subtracted samples.
+     * @param input Current (filtered) temperature (°C)
+     * @param rate Temperature slope (°C/s)
+     * @param dt Time since the previous sample in seconds
+     * @return Control output (0-100% fan speed)
+     */
+    float updateWithRate(float input, float rate, float dt) {
+        state_.error = config_.setpoint - input;
+        state_.p_term = config_.kp * state_.error;
+        integrate(state_.error, dt);
+        state_.i_term = config_.ki * state_.integral;
+        state_.derivative = -rate;
+        state_.d_term = config_.kd * state_.derivative;
+        state_.first_run = false;
+        state_.held_time = 0.0f;
+        return finishUpdate();
+    }
 
-        return state_.output;
+    /**
+     * @brief Integrate a sample while the output is held (event-driven mode)
+     *
+     * Keeps the integral exact across cycles where the control law is not
+     * evaluated. The output, error history and derivative are untouched; the
+     * next update() spreads its derivative over the held time.
+     *
+     * @param input Current temperature reading (°C)
+     * @param dt Time since the previous sample in seconds
+     */
+    void hold(float input, float dt = 1.0f) {
+        integrate(config_.setpoint - input, dt);
+        state_.held_time += dt;
     }
 
     /**
@@ -130,6 +165,35 @@ public:
         config_.kd = kd;
     }
 
+    /**
+     * @brief Change the configuration of a running loop without an output step
+     *
+     * The integral is rescaled so ki * integral, the integral term's share
+     * of the output, is the same under the new ki (bumpless retuning).
+     * @param config New configuration
+     */
+    void retune(const Config& config) {
+        if (config_.ki > 0.0f && config.ki > 0.0f) {
+            state_.integral *= config_.ki / config.ki;
+        }
+        config_ = config;
+        state_.integral = std::max(-config_.integral_max, std::min(config_.integral_max, state_.integral));
+    }
+
+    /**
+     * @brief Resume from a saved integral instead of zero (warm start)
+     *
+     * The error history stays empty, so the next update() still skips the
+     * derivative; only the accumulated integral and reported output carry over.
+     * @param integral Saved integral, clamped to the anti-windup limit
+     * @param output Saved output, reported until the next update()
+     */
+    void warmStart(float integral, float output) {
+        state_ = State{};
+        state_.integral = std::max(-config_.integral_max, std::min(config_.integral_max, integral));
+        state_.output = std::max(config_.output_min, std::min(config_.output_max, output));
+    }
+
     /**
      * @brief Reset PID controller state
      */
@@ -172,4 +236,29 @@ public:
         else if (state_.output < 75.0f) return "HIGH";
         else return "MAX";
     }
+
+private:
+    // Shared tail of update() and updateWithRate(): sum, clamp, remember the error
+    float finishUpdate() {
+        // Calculate total output (invert for cooling applications)
+        // When error is negative (too hot), we want positive output (fan speed)
+        state_.output = -(state_.p_term + state_.i_term + state_.d_term);
+
+        // Clamp output to valid range
+        state_.output = std::max(config_.output_min, 
+                               std::min(config_.output_max, state_.output));
+
+        // Store error for next derivative calculation
+        state_.error_prev = state_.error;
+        state_.update_count++;
+
+        return state_.output;
+    }
+
+    void integrate(float error, float dt) {
+        state_.integral += error * dt;
+        // Prevent integral windup
+        state_.integral = std::max(-config_.integral_max, 
+                                 std::min(config_.integral_max, state_.integral));
+    }
 };
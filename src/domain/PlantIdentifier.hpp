@@ -0,0 +1,250 @@
+#pragma once
+
+/**
+ * @file PlantIdentifier.hpp
+ * @brief Online first-order-plus-dead-time identification by recursive
+ *        least squares, with SIMC gain proposals
+ *
+ * Fits the sampled model
+ *
+ *   y[k] = a * y[k-1] + b * u[k-d] + c
+ *
+ * where y is the temperature, u[k] the controller output (fraction of full
+ * scale) held over the interval that ends at y[k], and c absorbs heat load
+ * and ambient. One 3-parameter RLS runs for
+ * each candidate dead time d = 1..kDelays samples; the candidate with the
+ * smallest smoothed a-priori prediction error is the model. d = 0 is left
+ * out on purpose: u[k] is computed from y[k-1], so in closed loop the
+ * regression would fit the controller's own feedback (measurement noise
+ * in y[k-1] echoed in u[k]) rather than the plant. From the model:
+ *
+ *   gain K = b / (1 - a) (°C per % output), time constant tau = -dt / ln(a),
+ *   dead time theta = d * dt
+ *
+ * Safeguards: exponential forgetting lets the fit follow slow drift
+ * (dust, ambient); the offset c gets extra random-walk covariance so
+ * heat-load steps land in c instead of biasing a and b; the covariance trace is capped so forgetting
+ * cannot blow it up while the loop sits still; P is re-symmetrized every
+ * step; an interval change restarts the fit, since a, b and the dead-time
+ * candidates are all per sample; and a model is only reported once it is
+ * physically plausible (0 < a < 1, cooling gain) after a warm-up.
+ *
+ * Cost per update is fixed: kDelays x (3x3 RLS step), about 160 flops.
+ */
+
+#include "PIDController.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+class PlantIdentifier {
+public:
+    static constexpr int kDelays = 4;   // Candidate dead times 1..4 samples
+
+    struct Config {
+        float forgetting = 0.999f;          // Memory of ~1 / (1 - forgetting) samples
+        float initial_covariance = 100.0f;
+        float max_trace = 1000.0f;          // Covariance cap (anti-windup for forgetting)
+        float error_smoothing = 0.02f;      // Weight of each sample in the model-selection error
+        uint32_t warmup_samples = 120;      // Samples before a model is reported
+        float dt_tolerance = 0.1f;          // Relative interval change that restarts the regressor
+        float offset_drift = 0.01f;         // Random-walk variance of c per sample (°C²)
+
+        // Tuning (SIMC): closed-loop time constant = tau_c_ratio * effective
+        // dead time, but no faster than min_tau_c * time constant
+        float tau_c_ratio = 1.0f;
+        float min_tau_c = 0.5f;
+        float max_gain_step = 0.2f;         // Largest relative gain change per proposal
+    };
+
+    struct Model {
+        float gain = 0.0f;              // °C per % output (negative: output cools)
+        float time_constant = 0.0f;     // s
+        float dead_time = 0.0f;         // s
+        float a = 0.0f;
+        float b = 0.0f;
+        float c = 0.0f;
+        float rms_error = 0.0f;         // One-step prediction error of the chosen fit (°C)
+        bool valid = false;
+    };
+
+    struct Stats {
+        uint32_t updates = 0;
+        uint32_t restarts = 0;          // Fit restarts after an interval change
+        uint32_t trace_clamps = 0;
+    };
+
+    PlantIdentifier() : PlantIdentifier(Config{}) {}
+    explicit PlantIdentifier(const Config& config) : config_(config) {
+        reset();
+    }
+
+    /**
+     * @brief Forget the fit and start over
+     */
+    void reset() {
+        for (Estimator& est : estimators_) {
+            est = Estimator{};
+            for (int i = 0; i < 3; i++) est.P[i][i] = config_.initial_covariance;
+        }
+        history_ = 0;
+        samples_ = 0;
+        dt_ = 0.0f;
+    }
+
+    /**
+     * @brief Add one sample
+     * @param temperature Reading at the end of the interval (°C)
+     * @param output Controller output held during the interval (%)
+     * @param dt Interval length (s); the fit assumes a fixed period and
+     *           starts over (reset()) when it changes by more than dt_tolerance
+     */
+    void update(float temperature, float output, float dt) {
+        if (dt_ == 0.0f || std::fabs(dt - dt_) > config_.dt_tolerance * dt_) {
+            if (dt_ != 0.0f) {
+                // a = exp(-dt / tau) and the delay candidates are per sample
+                // of the old period: fitting on from them would mix the two
+                stats_.restarts++;
+                reset();
+            }
+            dt_ = dt;
+        }
+
+        // y relative to the first sample and u as a fraction keep the
+        // regressors of similar size, which single precision needs
+        if (history_ == 0) y_ref_ = temperature;
+        float y = temperature - y_ref_;
+        shiftInput(output * 0.01f);
+
+        if (history_ > kDelays) {
+            for (int d = 0; d < kDelays; d++) {
+                float phi[3] = {y_prev_, inputs_[d + 1], 1.0f};
+                step(estimators_[d], phi, y);
+            }
+            samples_++;
+            stats_.updates++;
+        } else {
+            history_++;
+        }
+        y_prev_ = y;
+    }
+
+    /**
+     * @brief Current best fit
+     */
+    Model model() const {
+        Model model;
+        int best = 0;
+        for (int d = 1; d < kDelays; d++) {
+            if (estimators_[d].error < estimators_[best].error) best = d;
+        }
+        const Estimator& est = estimators_[best];
+        model.a = est.theta[0];
+        model.b = est.theta[1];
+        model.c = est.theta[2];
+        model.rms_error = std::sqrt(est.error);
+        model.dead_time = (best + 1) * dt_;
+        model.valid = samples_ >= config_.warmup_samples && model.a > 0.0f && model.a < 0.9999f &&
+                      model.b < 0.0f;
+        if (model.valid) {
+            model.gain = model.b / (1.0f - model.a) * 0.01f;
+            model.time_constant = -dt_ / std::log(model.a);
+        }
+        return model;
+    }
+
+    /**
+     * @brief SIMC PI gains for the current model, rate-limited around @p current
+     *
+     * kd and the rest of the configuration are kept. The effective dead
+     * time includes half a sample for the zero-order hold.
+     * @return false if there is no valid model yet
+     */
+    bool propose(const PIDController::Config& current, PIDController::Config& proposed) const {
+        Model fit = model();
+        if (!fit.valid) return false;
+        float theta = fit.dead_time + 0.5f * dt_;
+        float tau_c = std::max(config_.tau_c_ratio * theta, config_.min_tau_c * fit.time_constant);
+        float kp = fit.time_constant / (-fit.gain * (tau_c + theta));
+        float tau_i = std::min(fit.time_constant, 4.0f * (tau_c + theta));
+        float ki = kp / tau_i;
+
+        proposed = current;
+        proposed.kp = limitStep(current.kp, kp);
+        proposed.ki = limitStep(current.ki, ki);
+        return true;
+    }
+
+    uint32_t samples() const { return samples_; }
+    const Stats& getStats() const { return stats_; }
+    const Config& getConfig() const { return config_; }
+
+private:
+    struct Estimator {
+        float theta[3] = {0.0f, 0.0f, 0.0f};
+        float P[3][3] = {};
+        float error = 0.0f;     // Smoothed squared a-priori error
+    };
+
+    void shiftInput(float u) {
+        for (int i = kDelays; i > 0; i--) inputs_[i] = inputs_[i - 1];
+        inputs_[0] = u;
+    }
+
+    void step(Estimator& est, const float (&phi)[3], float y) {
+        float predicted = est.theta[0] * phi[0] + est.theta[1] * phi[1] + est.theta[2] * phi[2];
+        float error = y - predicted;
+        est.error += config_.error_smoothing * (error * error - est.error);
+
+        float p_phi[3];
+        for (int i = 0; i < 3; i++) {
+            p_phi[i] = est.P[i][0] * phi[0] + est.P[i][1] * phi[1] + est.P[i][2] * phi[2];
+        }
+        float denom = config_.forgetting + phi[0] * p_phi[0] + phi[1] * p_phi[1] + phi[2] * p_phi[2];
+        float inv_lambda = 1.0f / config_.forgetting;
+        for (int i = 0; i < 3; i++) {
+            float k = p_phi[i] / denom;
+            est.theta[i] += k * error;
+        }
+
+        // P = (P - P phi phi^T P / denom) / lambda, symmetric by construction
+        float trace = 0.0f;
+        for (int i = 0; i < 3; i++) {
+            for (int j = i; j < 3; j++) {
+                float value = (est.P[i][j] - p_phi[i] * p_phi[j] / denom) * inv_lambda;
+                est.P[i][j] = est.P[j][i] = value;
+            }
+            trace += est.P[i][i];
+        }
+        // The offset follows heat-load steps much faster than a and b drift
+        est.P[2][2] += config_.offset_drift;
+        if (!(trace <= config_.max_trace)) {
+            // Unexcited loop: stop the covariance from growing without bound
+            float scale = std::isfinite(trace) ? config_.max_trace / trace : 0.0f;
+            for (auto& row : est.P) {
+                for (float& value : row) value *= scale;
+            }
+            if (scale == 0.0f) {
+                for (int i = 0; i < 3; i++) est.P[i][i] = config_.initial_covariance;
+            }
+            stats_.trace_clamps++;
+        }
+    }
+
+    float limitStep(float current, float target) const {
+        if (current <= 0.0f) return target;
+        float lo = current * (1.0f - config_.max_gain_step);
+        float hi = current * (1.0f + config_.max_gain_step);
+        return std::max(lo, std::min(hi, target));
+    }
+
+    Config config_;
+    Estimator estimators_[kDelays];
+    float inputs_[kDelays + 1] = {};    // u[k], u[k-1], ... (fractions)
+    float y_prev_ = 0.0f;
+    float y_ref_ = 0.0f;
+    float dt_ = 0.0f;
+    uint32_t history_ = 0;
+    uint32_t samples_ = 0;
+    Stats stats_;
+};
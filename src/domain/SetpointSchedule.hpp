@@ -0,0 +1,83 @@
+#pragma once
+
+/**
+ * @file SetpointSchedule.hpp
+ * @brief Time-of-day setpoint tables in flash
+ *
+ * A schedule is a constexpr array of 4-byte points (minute of the day,
+ * setpoint in hundredths of a degree), sorted by time. The setpoint at
+ * any minute is that of the last point at or before it; before the first
+ * point of the day the last point of the previous day still holds.
+ *
+ *   constexpr SchedulePoint kOffice[] = {
+ *       schedulePoint(6, 30, 24.0f), schedulePoint(19, 0, 27.0f),
+ *   };
+ *   static_assert(SetpointSchedule(kOffice).valid(), "sorted, within one day");
+ *
+ * Feed the result to AdvancedTemperatureController::setSetpoint(); with a
+ * SetpointTrajectory the change is then ramped rather than stepped.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+struct SchedulePoint {
+    uint16_t minute;        // Minute of the day, 0-1439
+    int16_t centidegrees;   // Setpoint in 0.01 °C
+};
+
+constexpr uint16_t kMinutesPerDay = 24 * 60;
+
+/**
+ * @brief Build a point from hours, minutes and °C (rounded to 0.01 °C)
+ */
+constexpr SchedulePoint schedulePoint(int hour, int minute, float celsius) {
+    return SchedulePoint{static_cast<uint16_t>(hour * 60 + minute),
+                         static_cast<int16_t>(celsius * 100.0f + (celsius < 0.0f ? -0.5f : 0.5f))};
+}
+
+class SetpointSchedule {
+public:
+    template <size_t N>
+    constexpr SetpointSchedule(const SchedulePoint (&points)[N]) : points_(points), count_(N) {}
+
+    /**
+     * @brief Points sorted by strictly increasing time within one day
+     */
+    constexpr bool valid() const {
+        if (count_ == 0) return false;
+        for (size_t i = 0; i < count_; i++) {
+            if (points_[i].minute >= kMinutesPerDay) return false;
+            if (i > 0 && points_[i].minute <= points_[i - 1].minute) return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Setpoint in force at @p minute_of_day (°C)
+     */
+    constexpr float at(uint16_t minute_of_day) const {
+        return points_[indexAt(minute_of_day)].centidegrees / 100.0f;
+    }
+
+    /**
+     * @brief Minute of the day of the next change after @p minute_of_day
+     */
+    constexpr uint16_t nextChange(uint16_t minute_of_day) const {
+        size_t next = (indexAt(minute_of_day) + 1) % count_;
+        return points_[next].minute;
+    }
+
+    constexpr size_t size() const { return count_; }
+
+private:
+    constexpr size_t indexAt(uint16_t minute_of_day) const {
+        // Tables are a handful of points: a linear scan is smallest
+        size_t index = count_ - 1;  // Wraps from the previous day
+        for (size_t i = 0; i < count_ && points_[i].minute <= minute_of_day; i++) index = i;
+        return index;
+    }
+
+    const SchedulePoint* points_;
+    size_t count_;
+};
@@ -0,0 +1,109 @@
+#pragma once
+
+/**
+ * @file SetpointTrajectory.hpp
+ * @brief Rate- and acceleration-limited setpoint profiles
+ *
+ * A step in the setpoint goes straight into the proportional term (and
+ * the derivative, on the error): the fan jumps to full speed and the
+ * integral winds up while the zone catches up. The trajectory moves the
+ * setpoint the PID sees towards the requested target instead:
+ *
+ *   - Step:   jump at once (the old behaviour)
+ *   - Ramp:   straight line at max_rate
+ *   - SCurve: rate ramps up and down at max_accel, capped at max_rate,
+ *             so the setpoint and its slope are both continuous
+ *
+ * A new target can arrive mid-move: the profile continues from the
+ * current value and rate without a jump. One update is a handful of
+ * flops and a square root.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+class SetpointTrajectory {
+public:
+    enum class Profile { Step, Ramp, SCurve };
+
+    struct Config {
+        Profile profile = Profile::SCurve;
+        float max_rate = 0.02f;     // °C/s (1.2 °C per minute)
+        float max_accel = 0.001f;   // °C/s², SCurve only: full rate after 20 s
+    };
+
+    SetpointTrajectory() : SetpointTrajectory(Config{}) {}
+    explicit SetpointTrajectory(const Config& config, float initial = 25.0f)
+        : config_(config), value_(initial), target_(initial) {}
+
+    /**
+     * @brief Move towards @p target from wherever the profile is now
+     */
+    void setTarget(float target) {
+        target_ = target;
+    }
+
+    /**
+     * @brief Jump to @p value and stop there
+     */
+    void reset(float value) {
+        value_ = value;
+        target_ = value;
+        rate_ = 0.0f;
+    }
+
+    /**
+     * @brief Advance the profile
+     * @param dt Time since the previous update (s)
+     * @return Setpoint for this cycle (°C)
+     */
+    float update(float dt) {
+        float remaining = target_ - value_;
+        switch (config_.profile) {
+        case Profile::Step:
+            value_ = target_;
+            rate_ = 0.0f;
+            break;
+        case Profile::Ramp: {
+            float step = std::max(-config_.max_rate * dt, std::min(config_.max_rate * dt, remaining));
+            value_ += step;
+            rate_ = dt > 0.0f ? step / dt : 0.0f;
+            break;
+        }
+        case Profile::SCurve: {
+            // Fastest rate that can still brake to zero at the target
+            float braking = std::sqrt(2.0f * config_.max_accel * std::fabs(remaining));
+            float desired = std::copysign(std::min(config_.max_rate, braking), remaining);
+            float dv = config_.max_accel * dt;
+            rate_ += std::max(-dv, std::min(dv, desired - rate_));
+            value_ += rate_ * dt;
+            // Sampling makes the braking curve a little late: never pass the target
+            if ((target_ - value_) * remaining <= 0.0f) {
+                value_ = target_;
+                rate_ = 0.0f;
+            }
+            break;
+        }
+        }
+        return value_;
+    }
+
+    float value() const { return value_; }
+    float target() const { return target_; }
+
+    /**
+     * @brief Current slope of the setpoint (°C/s)
+     */
+    float rate() const { return rate_; }
+
+    bool settled() const { return value_ == target_ && rate_ == 0.0f; }
+
+    void setConfig(const Config& config) { config_ = config; }
+    const Config& getConfig() const { return config_; }
+
+private:
+    Config config_;
+    float value_;
+    float target_;
+    float rate_ = 0.0f;
+};
@@ -0,0 +1,261 @@
+#pragma once
+
+/**
+ * @file SignalPipeline.hpp
+ * @brief Compile-time composable signal-processing pipeline
+ *
+ * Sits between a sensor reading and PIDController::update(). Stages are
+ * listed as template arguments and fused into a single inlined call chain;
+ * the state of every stage lives in one trivially-copyable struct, so a
+ * zero-initialised State is always a valid starting point.
+ *
+ * Example:
+ * @code
+ * struct BoardCal  { static constexpr float gain = 1.02f; static constexpr float offset = -0.4f; };
+ * struct Smoothing { static constexpr float alpha = 0.25f; };
+ * struct MaxSlew   { static constexpr float max_step = 0.5f; };
+ *
+ * using Pipeline = SignalPipeline<Calibrate<BoardCal>, MedianOf<5>,
+ *                                 LowPass<Smoothing>, RateLimit<MaxSlew>>;
+ * Pipeline::State state{};
+ * float filtered = Pipeline::process(state, raw_celsius);
+ * @endcode
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace pipeline {
+
+/**
+ * @brief Linear calibration: y = gain * x + offset
+ * @tparam Cal Policy providing `static constexpr float gain` and `offset`
+ */
+template <typename Cal>
+struct Calibrate {
+    struct State {};
+
+    static inline float process(State&, float x) {
+        return Cal::gain * x + Cal::offset;
+    }
+};
+
+/**
+ * @brief Median of the last N samples (spike rejection)
+ *
+ * Until N samples have been seen the median of the available samples is
+ * returned, so the stage needs no warm-up period.
+ */
+template <std::size_t N>
+struct MedianOf {
+    static_assert(N >= 1 && N <= 15, "MedianOf supports windows of 1 to 15 samples");
+
+    struct State {
+        float window[N];
+        uint8_t head;
+        uint8_t count;
+    };
+
+    static inline float process(State& s, float x) {
+        const uint8_t slot = s.head;
+        s.head = static_cast<uint8_t>(slot + 1 == N ? 0 : slot + 1);
+        if (s.count < N) {
+            s.window[slot] = x;
+            s.count++;
+            return partialMedian(s);
+        }
+
+        // Odd-even transposition network built from min/max, which compile
+        // to branch-free instructions. Every pair within a round is
+        // independent, so the dependency depth is N rounds rather than the
+        // N^2 chain of an insertion sort. Rounds are unrolled at compile time.
+        // The window is copied before the new sample is stored so the wide
+        // load does not stall on a narrow store to the same line.
+        float v[N];
+        for (std::size_t i = 0; i < N; ++i) v[i] = s.window[i];
+        v[slot] = x;
+        s.window[slot] = x;
+        rounds(v, std::make_index_sequence<N>{});
+        return v[N / 2];
+    }
+
+private:
+    static inline void compareExchange(float& a, float& b) {
+        // Written in the minss/maxss operand order so no branch is emitted
+        float lo = b < a ? b : a;
+        float hi = a < b ? b : a;
+        a = lo;
+        b = hi;
+    }
+
+    template <std::size_t First, std::size_t... K>
+    static inline void round(float* v, std::index_sequence<K...>) {
+        (compareExchange(v[First + 2 * K], v[First + 2 * K + 1]), ...);
+    }
+
+    template <std::size_t... R>
+    static inline void rounds(float* v, std::index_sequence<R...>) {
+        (round<R % 2>(v, std::make_index_sequence<(N - R % 2) / 2>{}), ...);
+    }
+
+    static float partialMedian(const State& s) {
+        float sorted[N];
+        for (uint8_t i = 0; i < s.count; ++i) {
+            float v = s.window[i];
+            uint8_t j = i;
+            while (j > 0 && sorted[j - 1] > v) {
+                sorted[j] = sorted[j - 1];
+                --j;
+            }
+            sorted[j] = v;
+        }
+        return sorted[s.count / 2];
+    }
+};
+
+/**
+ * @brief First-order IIR low-pass: y += alpha * (x - y)
+ * @tparam Coeff Policy providing `static constexpr float alpha` in (0, 1]
+ */
+template <typename Coeff>
+struct LowPass {
+    static_assert(Coeff::alpha > 0.0f && Coeff::alpha <= 1.0f, "alpha must be in (0, 1]");
+
+    struct State {
+        float y;
+        bool primed;
+    };
+
+    static inline float process(State& s, float x) {
+        if (!s.primed) {
+            s.y = x;
+            s.primed = true;
+        } else {
+            s.y += Coeff::alpha * (x - s.y);
+        }
+        return s.y;
+    }
+};
+
+/**
+ * @brief Slew-rate limiter: output moves at most max_step per sample
+ * @tparam Limit Policy providing `static constexpr float max_step` (> 0)
+ */
+template <typename Limit>
+struct RateLimit {
+    static_assert(Limit::max_step > 0.0f, "max_step must be positive");
+
+    struct State {
+        float y;
+        bool primed;
+    };
+
+    static inline float process(State& s, float x) {
+        if (!s.primed) {
+            s.y = x;
+            s.primed = true;
+            return s.y;
+        }
+        // Clamp without branches; noisy input mispredicts an if/else chain
+        float delta = x - s.y;
+        delta = Limit::max_step < delta ? Limit::max_step : delta;
+        delta = delta < -Limit::max_step ? -Limit::max_step : delta;
+        s.y += delta;
+        return s.y;
+    }
+};
+
+enum class Unit { Celsius, Fahrenheit, Kelvin };
+
+/**
+ * @brief Temperature unit conversion, folded to a single multiply-add
+ */
+template <Unit From, Unit To>
+struct ConvertUnits {
+    struct State {};
+
+    static constexpr float toCelsiusScale() { return From == Unit::Fahrenheit ? 5.0f / 9.0f : 1.0f; }
+    static constexpr float toCelsiusOffset() {
+        return From == Unit::Fahrenheit ? -32.0f * 5.0f / 9.0f
+             : From == Unit::Kelvin     ? -273.15f
+             : 0.0f;
+    }
+    static constexpr float fromCelsiusScale() { return To == Unit::Fahrenheit ? 9.0f / 5.0f : 1.0f; }
+    static constexpr float fromCelsiusOffset() {
+        return To == Unit::Fahrenheit ? 32.0f
+             : To == Unit::Kelvin     ? 273.15f
+             : 0.0f;
+    }
+
+    static constexpr float scale = toCelsiusScale() * fromCelsiusScale();
+    static constexpr float offset = toCelsiusOffset() * fromCelsiusScale() + fromCelsiusOffset();
+
+    static inline float process(State&, float x) {
+        return scale * x + offset;
+    }
+};
+
+/**
+ * @brief Aggregate state for a stage list (head stage first)
+ */
+template <typename... Stages>
+struct PipelineState {};
+
+template <typename First, typename... Rest>
+struct PipelineState<First, Rest...> {
+    typename First::State head;
+    PipelineState<Rest...> tail;
+};
+
+} // namespace pipeline
+
+/**
+ * @brief Pipeline of stages applied left to right
+ * @tparam Stages Stage types exposing `State` and `static float process(State&, float)`
+ */
+template <typename... Stages>
+class SignalPipeline {
+public:
+    using State = pipeline::PipelineState<Stages...>;
+
+    static_assert(std::is_trivially_copyable<State>::value, "pipeline state must be trivially copyable");
+
+    static constexpr std::size_t stage_count = sizeof...(Stages);
+
+    /**
+     * @brief Run one sample through every stage
+     * @param state Pipeline state (zero-initialise before first use)
+     * @param x Input sample
+     * @return Filtered sample
+     */
+    static inline float process(State& state, float x) {
+        return run(state, x);
+    }
+
+    /**
+     * @brief Run a block of samples through the pipeline
+     * @param state Pipeline state
+     * @param in Input samples
+     * @param out Output samples (may alias in)
+     * @param count Number of samples
+     */
+    static void processBlock(State& state, const float* in, float* out, std::size_t count) {
+        State local = state; // keep state in registers for the whole block
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = run(local, in[i]);
+        }
+        state = local;
+    }
+
+private:
+    static inline float run(pipeline::PipelineState<>&, float x) {
+        return x;
+    }
+
+    template <typename First, typename... Rest>
+    static inline float run(pipeline::PipelineState<First, Rest...>& s, float x) {
+        return run(s.tail, First::process(s.head, x));
+    }
+};
@@ -0,0 +1,139 @@
+#pragma once
+
+/**
+ * @file SmithPredictor.hpp
+ * @brief Dead-time compensation for probes far from the heat source
+ *
+ * A Smith predictor runs a first-order model of the zone alongside the
+ * loop, twice: once as is and once through a copy of the transport delay.
+ * The PID is fed
+ *
+ *   feedback = measured + model(now) - model(now - dead_time)
+ *
+ * With an exact model the delayed model output cancels the measurement's
+ * response to the controller, leaving the undelayed model response plus
+ * any disturbance the model does not know about: the PID acts as if the
+ * probe had no dead time and can keep the gains tuned for the delay-free
+ * zone. Disturbances still arrive late; steady-state offsets cancel, so
+ * the model only has to be linear around the operating point.
+ *
+ * The model is kept in deviation form (driven by the output only, at rest
+ * at the first output it sees), so it needs no ambient or heat-load term. The delay line is a
+ * fixed ring of model outputs with their intervals, so the controller's
+ * period may vary: the delayed value is interpolated at dead_time ago.
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+class SmithPredictor {
+public:
+    static constexpr size_t kMaxDelaySamples = 64;   // Dead time / shortest period
+
+    /**
+     * @brief First-order-plus-dead-time model of the zone
+     */
+    struct Model {
+        float gain = -0.2f;          // °C per % output (negative: output cools)
+        float time_constant = 20.0f; // s
+        float dead_time = 5.0f;      // s
+    };
+
+    SmithPredictor() : SmithPredictor(Model{}) {}
+    explicit SmithPredictor(const Model& model) : model_(model) {}
+
+    /**
+     * @brief Advance the model by @p dt with @p output held, then compensate @p measured
+     * @param measured Reading at the end of the interval (°C)
+     * @param output Controller output held over the interval (%)
+     * @param dt Interval length (s)
+     * @return Reading with the predicted, not yet visible, response added (°C)
+     */
+    float update(float measured, float output, float dt) {
+        if (count_ == 0) rest_ = response_ = model_.gain * output;
+
+        // Exact discretization for a held input
+        float a = std::exp(-dt / model_.time_constant);
+        response_ = a * response_ + (1.0f - a) * model_.gain * output;
+
+        history_[head_] = {response_, dt};
+        head_ = (head_ + 1) % kMaxDelaySamples;
+        if (count_ < kMaxDelaySamples) count_++;
+
+        correction_ = response_ - delayedResponse();
+        return measured + correction_;
+    }
+
+    /**
+     * @brief Forget the model history (e.g. after the loop was off)
+     */
+    void reset() {
+        response_ = 0.0f;
+        rest_ = 0.0f;
+        correction_ = 0.0f;
+        count_ = 0;
+        head_ = 0;
+    }
+
+    /**
+     * @brief Replace the model; the history is reset
+     */
+    void setModel(const Model& model) {
+        model_ = model;
+        reset();
+    }
+
+    /**
+     * @brief Predicted response still in transit to the probe (°C)
+     */
+    float correction() const { return correction_; }
+
+    /**
+     * @brief Updates where the ring was shorter than the dead time; the
+     *        oldest sample was used instead (raise kMaxDelaySamples or the period)
+     */
+    uint32_t overflows() const { return overflows_; }
+
+    const Model& getModel() const { return model_; }
+
+private:
+    struct Sample {
+        float response;
+        float dt;       // Interval that ended with this sample
+    };
+
+    /**
+     * @brief Model output dead_time ago, interpolated between samples
+     */
+    float delayedResponse() {
+        float age = 0.0f;
+        size_t index = (head_ + kMaxDelaySamples - 1) % kMaxDelaySamples;
+        for (size_t n = 0; n < count_; n++) {
+            const Sample& sample = history_[index];
+            if (age + sample.dt >= model_.dead_time) {
+                // The previous sample is dt older; before the history starts the model was at rest
+                size_t older = (index + kMaxDelaySamples - 1) % kMaxDelaySamples;
+                float previous = n + 1 < count_                 ? history_[older].response
+                                 : count_ < kMaxDelaySamples ? rest_
+                                                             : sample.response;
+                float fraction = (model_.dead_time - age) / sample.dt;
+                return sample.response + fraction * (previous - sample.response);
+            }
+            age += sample.dt;
+            index = (index + kMaxDelaySamples - 1) % kMaxDelaySamples;
+        }
+        if (count_ < kMaxDelaySamples) return rest_;
+        overflows_++;
+        return history_[head_].response;
+    }
+
+    Model model_;
+    Sample history_[kMaxDelaySamples] = {};
+    size_t head_ = 0;     // Next slot to write
+    size_t count_ = 0;
+    float response_ = 0.0f;
+    float rest_ = 0.0f;     // Response before the first sample
+    float correction_ = 0.0f;
+    uint32_t overflows_ = 0;
+};
@@ -0,0 +1,159 @@
+#pragma once
+
+/**
+ * @file TemperatureEstimator.hpp
+ * @brief Two-state Kalman filter for temperature and its rate of change
+ *
+ * State x = [T, d]: the enclosure temperature (°C) and the heating rate
+ * the fan is working against (°C/s), modelled as a random walk. The fan
+ * is the known control input: at airflow a (0-100, given directly or
+ * from the fan's duty via Config::airflow) it carries heat away in
+ * proportion to the difference to ambient, as in the enclosure's thermal
+ * model, so
+ *
+ *   T' = T + (d - c * (T - ambient)) * dt,   d' = d,   c = fan_conductance * a / 100
+ *
+ * The filter tracks the slope dT/dt = d - c * (T - ambient), which the PID uses in
+ * place of a difference of two noisy readings. Because the fan's effect
+ * is predicted rather than waited for, the estimate stays current at
+ * longer sample periods than a low-pass filter of the same smoothness.
+ *
+ * Everything is fixed-size (2x2 covariance, scalar measurement): one
+ * update is ~30 flops and no allocation.
+ */
+
+#include "FanCurve.hpp"
+#include <cmath>
+
+class TemperatureEstimator {
+public:
+    using Vector = float[2];
+    using Matrix = float[2][2];
+
+    struct Config {
+        float measurement_noise = 0.2f;  // Sensor noise std dev (°C)
+        float temperature_noise = 0.05f; // Unmodelled temperature change (°C/√s)
+        float rate_noise = 0.01f;        // Heating-rate drift (°C/s per √s)
+        float fan_conductance = 0.15f;   // Fan heat loss at 100% airflow / heat capacity (1/s)
+        float ambient = 22.0f;           // Air the fan draws in (°C)
+        float initial_rate_std = 0.1f;   // Prior uncertainty of d (°C/s)
+        float (*airflow)(float duty) = &QuadraticFanCurve::airflow;  // Duty to airflow for predict()/update()
+    };
+
+    TemperatureEstimator() : TemperatureEstimator(Config{}) {}
+    explicit TemperatureEstimator(const Config& config) : config_(config) {}
+
+    /**
+     * @brief Advance by @p dt seconds with the fan at @p fan_duty percent
+     *        (the output applied over that interval)
+     */
+    void predict(float dt, float fan_duty) {
+        predictWithAirflow(dt, config_.airflow(fan_duty));
+    }
+
+    /**
+     * @brief predict() with the fan's delivered @p airflow percent instead of its duty
+     */
+    void predictWithAirflow(float dt, float airflow) {
+        airflow_ = airflow;
+        float c = config_.fan_conductance * 0.01f * airflow_;
+        x_[0] += (x_[1] - c * (x_[0] - config_.ambient)) * dt;
+
+        // P = F P F^T + Q with F = [[f, dt], [0, 1]], f = 1 - c dt, and
+        // the integrated white-noise-rate covariance for Q
+        float f = 1.0f - c * dt;
+        float p00 = f * f * P_[0][0] + 2.0f * f * dt * P_[0][1] + dt * dt * P_[1][1];
+        float p01 = f * P_[0][1] + dt * P_[1][1];
+        float qd = config_.rate_noise * config_.rate_noise;
+        float qt = config_.temperature_noise * config_.temperature_noise;
+        P_[0][0] = p00 + qt * dt + qd * dt * dt * dt / 3.0f;
+        P_[0][1] = P_[1][0] = p01 + qd * dt * dt / 2.0f;
+        P_[1][1] += qd * dt;
+    }
+
+    /**
+     * @brief Fuse a reading; the first one initializes the filter
+     */
+    void correct(float measured) {
+        if (!initialized_) {
+            reset(measured);
+            return;
+        }
+        // H = [1, 0]: the innovation variance is P00 + R
+        float r = config_.measurement_noise * config_.measurement_noise;
+        float innovation = measured - x_[0];
+        float s = P_[0][0] + r;
+        float k0 = P_[0][0] / s;
+        float k1 = P_[1][0] / s;
+        x_[0] += k0 * innovation;
+        x_[1] += k1 * innovation;
+        innovation_ = innovation;
+
+        // P = (I - K H) P, kept symmetric
+        float p00 = (1.0f - k0) * P_[0][0];
+        float p01 = (1.0f - k0) * P_[0][1];
+        float p11 = P_[1][1] - k1 * P_[0][1];
+        P_[0][0] = p00;
+        P_[0][1] = P_[1][0] = p01;
+        P_[1][1] = p11;
+        gain_[0] = k0;
+        gain_[1] = k1;
+    }
+
+    /**
+     * @brief predict() then correct(): one control cycle
+     */
+    void update(float measured, float dt, float fan_duty) {
+        updateWithAirflow(measured, dt, config_.airflow(fan_duty));
+    }
+
+    /**
+     * @brief update() with the fan's delivered @p airflow percent instead of its duty
+     */
+    void updateWithAirflow(float measured, float dt, float airflow) {
+        if (initialized_) predictWithAirflow(dt, airflow);
+        else airflow_ = airflow;
+        correct(measured);
+    }
+
+    /**
+     * @brief Start from @p temperature with an unknown heating rate
+     */
+    void reset(float temperature) {
+        x_[0] = temperature;
+        x_[1] = fanCooling(temperature);    // Assume equilibrium
+        P_[0][0] = config_.measurement_noise * config_.measurement_noise;
+        P_[0][1] = P_[1][0] = 0.0f;
+        P_[1][1] = config_.initial_rate_std * config_.initial_rate_std;
+        innovation_ = 0.0f;
+        initialized_ = true;
+    }
+
+    float temperature() const { return x_[0]; }
+
+    /**
+     * @brief Current slope dT/dt (°C/s) at the last fan airflow
+     */
+    float rate() const { return x_[1] - fanCooling(x_[0]); }
+
+    float heatingRate() const { return x_[1]; }
+    float temperatureStd() const { return std::sqrt(P_[0][0]); }
+    float innovation() const { return innovation_; }
+    const Vector& gain() const { return gain_; }
+    const Matrix& covariance() const { return P_; }
+    bool initialized() const { return initialized_; }
+    const Config& getConfig() const { return config_; }
+
+private:
+    float fanCooling(float temperature) const {
+        return config_.fan_conductance * 0.01f * airflow_ * (temperature - config_.ambient);
+    }
+
+    Config config_;
+    Vector x_ = {0.0f, 0.0f};
+    Matrix P_ = {{0.0f, 0.0f}, {0.0f, 0.0f}};
+    Vector gain_ = {0.0f, 0.0f};
+    float airflow_ = 0.0f;
+    float innovation_ = 0.0f;
+    bool initialized_ = false;
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+/**
+ * @file AdcScanGroup.hpp
+ * @brief Multi-channel ADC acquisition in one driver transaction
+ *
+ * The channel sequence is configured once. Each scan() then converts every
+ * channel in a single burst, instead of one blocking read per thermistor.
+ * channel(i) returns an ISensor view of the latest scan result, so any
+ * controller can consume one channel. Call scan() once per cycle before
+ * regulating; reading a view does not start a conversion.
+ *
+ * Each position converts with its own Conversion: the LM35 scale by
+ * default, or e.g. Ntc10kTable::toCelsius for a thermistor divider, so
+ * one scan can serve mixed sensors.
+ */
+
+#include "ISensor.hpp"
+#include "TemperatureProcessor.hpp"
+#include "drivers.hpp"
+#include <cstddef>
+#include <cstdint>
+
+class AdcScanGroup {
+public:
+    static constexpr size_t kMaxChannels = AdcScanDriver::kMaxChannels;
+
+    /**
+     * @brief ADC code to °C, as the matching single-channel sensor converts
+     */
+    using Conversion = float (*)(uint16_t raw);
+
+    /**
+     * @brief ISensor view of one channel in the group
+     */
+    class ChannelSensor final : public ISensor {
+    public:
+        float readValue() override {
+            return group_->celsius(index_);
+        }
+
+    private:
+        friend class AdcScanGroup;
+        const AdcScanGroup* group_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    /**
+     * @brief Configure the scan sequence
+     * @param driver Multi-channel ADC
+     * @param channels Hardware channel IDs, unique and ascending
+     * @param count Number of channels (1 to kMaxChannels)
+     */
+    AdcScanGroup(AdcScanDriver& driver, const uint8_t* channels, size_t count)
+        : driver_(driver), count_(count <= kMaxChannels ? count : 0) {
+        configured_ = count_ > 0 && driver_.configure(channels, count_);
+        for (size_t i = 0; i < kMaxChannels; i++) {
+            views_[i].group_ = this;
+            views_[i].index_ = i;
+            conversions_[i] = &TemperatureProcessor::toCelsius;
+        }
+    }
+
+    AdcScanGroup(const AdcScanGroup&) = delete;
+    AdcScanGroup& operator=(const AdcScanGroup&) = delete;
+
+    /**
+     * @brief Convert all channels in one transaction
+     * @return false if unconfigured or the driver failed (previous samples kept)
+     */
+    bool scan() {
+        if (!configured_) return false;
+        if (!driver_.scan(scratch_)) {
+            failed_scans_++;
+            return false;
+        }
+        for (size_t i = 0; i < count_; i++) {
+            samples_[i] = scratch_[i];
+        }
+        scans_++;
+        return true;
+    }
+
+    bool isConfigured() const { return configured_; }
+    size_t size() const { return count_; }
+
+    /**
+     * @brief Raw sample of position @p index in the sequence from the last scan
+     */
+    uint16_t raw(size_t index) const { return samples_[index]; }
+
+    float celsius(size_t index) const {
+        return conversions_[index](samples_[index]);
+    }
+
+    /**
+     * @brief Convert position @p index with @p convert instead of the LM35 scale
+     * @param convert e.g. &Ntc10kTable::toCelsius; nullptr restores the default
+     */
+    void setConversion(size_t index, Conversion convert) {
+        if (index >= kMaxChannels) return;
+        conversions_[index] = convert ? convert : &TemperatureProcessor::toCelsius;
+    }
+
+    /**
+     * @brief Latest raw samples for all channels, in sequence order
+     */
+    const uint16_t* samples() const { return samples_; }
+
+    /**
+     * @brief Sensor view of position @p index in the sequence
+     */
+    ChannelSensor& channel(size_t index) { return views_[index]; }
+
+    uint32_t getScanCount() const { return scans_; }
+    uint32_t getFailedScanCount() const { return failed_scans_; }
+
+private:
+    AdcScanDriver& driver_;
+    size_t count_;
+    bool configured_ = false;
+    uint16_t scratch_[kMaxChannels] = {};   // DMA target; copied only on success
+    uint16_t samples_[kMaxChannels] = {};
+    ChannelSensor views_[kMaxChannels];
+    Conversion conversions_[kMaxChannels];
+    uint32_t scans_ = 0;
+    uint32_t failed_scans_ = 0;
+};
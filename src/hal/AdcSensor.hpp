@@ -2,11 +2,13 @@
 #include "ISensor.hpp"
 #include "TemperatureProcessor.hpp"
 #include "drivers.hpp"
+#include "Trace.hpp"
 
 class AdcSensor : public ISensor {
 public:
     AdcSensor(AdcDriver& adc) : adc_(adc) {}
     float readValue() override {
+        TEMPCTRL_TRACE_SCOPE("sensor_read");
         return TemperatureProcessor::toCelsius(adc_.readRaw());
     }
 private:
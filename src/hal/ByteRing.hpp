@@ -0,0 +1,104 @@
+#pragma once
+
+/**
+ * @file ByteRing.hpp
+ * @brief Single-producer single-consumer byte ring for UART receive
+ *
+ * The producer (RX interrupt, or the pty reader thread in simulation)
+ * pushes bytes; the consumer inspects them in place with peek()/span()
+ * and releases them with consume(). Head and tail are free-running
+ * counters, so the capacity (a power of two) is fully usable.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+class ByteRing {
+public:
+    /**
+     * @param storage Buffer of @p capacity bytes
+     * @param capacity Power of two
+     */
+    ByteRing(uint8_t* storage, size_t capacity)
+        : data_(storage), mask_(static_cast<uint32_t>(capacity - 1)) {}
+
+    ByteRing(const ByteRing&) = delete;
+    ByteRing& operator=(const ByteRing&) = delete;
+
+    // Producer side
+
+    /**
+     * @return false if the ring is full; the byte is dropped and counted
+     */
+    bool push(uint8_t byte) {
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) > mask_) {
+            overflows_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        data_[head & mask_] = byte;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t push(const uint8_t* bytes, size_t size) {
+        size_t pushed = 0;
+        while (pushed < size && push(bytes[pushed])) pushed++;
+        return pushed;
+    }
+
+    // Consumer side
+
+    size_t available() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Byte @p offset positions past the oldest; requires offset < available()
+     */
+    uint8_t peek(size_t offset) const {
+        return data_[(tail_.load(std::memory_order_relaxed) + offset) & mask_];
+    }
+
+    /**
+     * @brief Contiguous run starting @p offset past the oldest byte
+     * @param length Receives the run length: up to @p max bytes, stopping at
+     *               the end of the storage (the rest continues at offset + length)
+     */
+    const uint8_t* span(size_t offset, size_t max, size_t& length) const {
+        uint32_t start = (tail_.load(std::memory_order_relaxed) + static_cast<uint32_t>(offset)) & mask_;
+        size_t to_end = mask_ + 1 - start;
+        length = max < to_end ? max : to_end;
+        return data_ + start;
+    }
+
+    void consume(size_t count) {
+        tail_.store(tail_.load(std::memory_order_relaxed) + static_cast<uint32_t>(count),
+                    std::memory_order_release);
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+    uint32_t overflows() const { return overflows_.load(std::memory_order_relaxed); }
+
+private:
+    uint8_t* data_;
+    uint32_t mask_;
+    std::atomic<uint32_t> head_{0};
+    std::atomic<uint32_t> tail_{0};
+    std::atomic<uint32_t> overflows_{0};
+};
+
+/**
+ * @brief ByteRing with its storage inline
+ */
+template <size_t Capacity>
+class StaticByteRing : public ByteRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+public:
+    StaticByteRing() : ByteRing(storage_, Capacity) {}
+
+private:
+    uint8_t storage_[Capacity];
+};
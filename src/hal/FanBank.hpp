@@ -0,0 +1,175 @@
+#pragma once
+
+/**
+ * @file FanBank.hpp
+ * @brief Several fans behind one variable actuator, staged for least power
+ *
+ * setOutput() takes the requested airflow of the whole bank (percent of
+ * all fans at full speed) and splits it across the fans. By the affinity
+ * laws a fan's shaft power grows with the cube of its speed, so two fans
+ * at half speed use a quarter of the power of one at full; each running
+ * fan also draws a fixed amount (drive electronics, bearings) however
+ * slowly it turns. The cheapest way to move a given airflow is therefore
+ * to run some number n of fans at equal speed, with n growing with the
+ * airflow:
+ *
+ *   P(n) = n * running_watts + n * rated_watts * (airflow per fan / 100)^3
+ *
+ * The bank airflow at which n + 1 fans become cheaper than n (or at which
+ * n fans run out of capacity) is computed once per configuration into a
+ * table of at most kMaxFans entries; setOutput() walks it with a little
+ * hysteresis so a fan does not start and stop around a threshold.
+ *
+ * Each running fan is driven at the duty that gives its share of airflow
+ * (FanLinearizer), which is always above the start-up dead zone: a fan is
+ * either stopped or really turning. The naive Equal and Sequential
+ * strategies are kept for comparison.
+ */
+
+#include "IVariableActuator.hpp"
+#include "VariableFan.hpp"
+#include "FanLinearizer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+class FanBank : public IVariableActuator {
+public:
+    static constexpr size_t kMaxFans = 8;
+
+    enum class Staging {
+        Optimal,     // Fewest-watts number of fans, sharing equally
+        Equal,       // Every fan at the same speed
+        Sequential,  // Fill one fan to full before starting the next
+    };
+
+    /**
+     * @brief Per-fan power model used for staging
+     */
+    struct Config {
+        Staging staging = Staging::Optimal;
+        float rated_watts = 6.0f;    // Speed-dependent power at full airflow (W)
+        float running_watts = 0.3f;  // Drawn by a running fan at any speed (W)
+        float hysteresis = 2.0f;     // Stage down this far below the stage-up point (% bank airflow)
+    };
+
+    /**
+     * @param fans Array of @p count fans (at most kMaxFans); must outlive the bank
+     */
+    FanBank(VariableFan* const* fans, size_t count) : FanBank(fans, count, Config{}) {}
+    FanBank(VariableFan* const* fans, size_t count, const Config& config)
+        : fans_(fans), count_(std::min(count, kMaxFans)) {
+        setConfig(config);
+    }
+
+    void setOutput(float percent) override {
+        requested_ = std::max(0.0f, std::min(100.0f, percent));
+        size_t stages = stagesFor(requested_);
+        if (stages != stages_) {
+            stage_changes_++;
+            stages_ = stages;
+        }
+
+        // Bank airflow in single-fan percent
+        float total = requested_ * count_;
+        for (size_t i = 0; i < count_; i++) {
+            float airflow;
+            if (config_.staging == Staging::Sequential) {
+                airflow = std::max(0.0f, std::min(100.0f, total - 100.0f * i));
+            } else {
+                airflow = i < stages_ ? total / stages_ : 0.0f;
+            }
+            fans_[i]->setOutput(Linearizer::dutyFor(airflow));
+        }
+    }
+
+    /**
+     * @brief Get requested bank airflow (not any fan's duty)
+     */
+    float getOutput() const override { return requested_; }
+
+    bool isActive() const override { return stages_ > 0; }
+
+    /**
+     * @brief Delivered airflow, percent of the whole bank at full speed
+     */
+    float getAirflow() const override {
+        float sum = 0.0f;
+        for (size_t i = 0; i < count_; i++) sum += fans_[i]->getAirflow();
+        return count_ > 0 ? sum / count_ : 0.0f;
+    }
+
+    /**
+     * @brief Electrical power of the bank under the configured model (W)
+     */
+    float estimatedPower() const {
+        float watts = 0.0f;
+        for (size_t i = 0; i < count_; i++) {
+            if (!fans_[i]->isActive()) continue;
+            float speed = fans_[i]->getAirflow() / 100.0f;
+            watts += config_.running_watts + config_.rated_watts * speed * speed * speed;
+        }
+        return watts;
+    }
+
+    /**
+     * @brief Number of fans currently running
+     */
+    size_t runningFans() const { return stages_; }
+
+    /**
+     * @brief Times the number of running fans changed (fan starts and stops)
+     */
+    uint32_t getStageChanges() const { return stage_changes_; }
+
+    /**
+     * @brief Bank airflow above which more than @p running fans run (%)
+     */
+    float stageUpAt(size_t running) const { return running < count_ ? stage_up_[running] : 100.0f; }
+
+    /**
+     * @brief Replace the power model and rebuild the staging table
+     */
+    void setConfig(const Config& config) {
+        config_ = config;
+        stage_up_[0] = 0.0f;
+        for (size_t n = 1; n < count_; n++) {
+            // n fans at capacity, or where P(n) = P(n + 1):
+            // (total / 100)^3 = running / (rated * (1/n^2 - 1/(n+1)^2))
+            float capacity = 100.0f * n / count_;
+            float gain = 1.0f / (n * n) - 1.0f / ((n + 1) * (n + 1));
+            float crossover = config_.rated_watts > 0.0f
+                                  ? 100.0f * std::cbrt(config_.running_watts / (config_.rated_watts * gain)) / count_
+                                  : capacity;
+            stage_up_[n] = std::min(capacity, crossover);
+        }
+    }
+
+    const Config& getConfig() const { return config_; }
+
+    size_t size() const { return count_; }
+
+private:
+    using Linearizer = FanLinearizer<VariableFan::Curve>;
+
+    size_t stagesFor(float airflow) const {
+        if (airflow <= 0.0f) return 0;
+        if (config_.staging == Staging::Equal) return count_;
+        if (config_.staging == Staging::Sequential) {
+            return std::min(count_, static_cast<size_t>(std::ceil(airflow * count_ / 100.0f)));
+        }
+        size_t stages = std::max<size_t>(stages_, 1);
+        while (stages < count_ && airflow > stage_up_[stages]) stages++;
+        while (stages > 1 && airflow <= stage_up_[stages - 1] - config_.hysteresis) stages--;
+        return stages;
+    }
+
+    VariableFan* const* fans_;
+    size_t count_;
+    Config config_;
+    float stage_up_[kMaxFans] = {};
+    float requested_ = 0.0f;
+    size_t stages_ = 0;
+    uint32_t stage_changes_ = 0;
+};
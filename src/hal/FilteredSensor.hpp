@@ -0,0 +1,30 @@
+#pragma once
+
+/**
+ * @file FilteredSensor.hpp
+ * @brief ISensor decorator that runs readings through a SignalPipeline
+ */
+
+#include "ISensor.hpp"
+#include "SignalPipeline.hpp"
+
+template <typename Pipeline>
+class FilteredSensor : public ISensor {
+public:
+    explicit FilteredSensor(ISensor& source) : source_(source) {}
+
+    float readValue() override {
+        return Pipeline::process(state_, source_.readValue());
+    }
+
+    /**
+     * @brief Discard filter history (e.g. after a sensor fault)
+     */
+    void reset() {
+        state_ = typename Pipeline::State{};
+    }
+
+private:
+    ISensor& source_;
+    typename Pipeline::State state_{};
+};
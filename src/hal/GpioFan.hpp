@@ -1,12 +1,37 @@
 #pragma once
 #include "IActuator.hpp"
+#include "GpioPort.hpp"
 #include "drivers.hpp"
+#include "Trace.hpp"
+#include <cstdint>
 
 class GpioFan : public IActuator {
 public:
-    GpioFan(GpioDriver& gpio) : gpio_(gpio) {}
-    void activate() override { gpio_.setHigh(); }
-    void deactivate() override { gpio_.setLow(); }
+    GpioFan(GpioDriver& gpio) : gpio_(&gpio) {}
+
+    /**
+     * @brief Fan on pin @p bit of a shared port; takes effect on GpioPort::commit()
+     */
+    GpioFan(GpioPort& port, uint8_t bit) : port_(&port), mask_(1u << bit) {}
+
+    void activate() override {
+        TEMPCTRL_TRACE_SCOPE("actuator_write");
+        if (port_) {
+            port_->set(mask_);
+        } else {
+            gpio_->setHigh();
+        }
+    }
+    void deactivate() override {
+        TEMPCTRL_TRACE_SCOPE("actuator_write");
+        if (port_) {
+            port_->clear(mask_);
+        } else {
+            gpio_->setLow();
+        }
+    }
 private:
-    GpioDriver& gpio_;
+    GpioDriver* gpio_ = nullptr;
+    GpioPort* port_ = nullptr;
+    uint32_t mask_ = 0;
 };
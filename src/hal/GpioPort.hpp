@@ -0,0 +1,76 @@
+#pragma once
+
+/**
+ * @file GpioPort.hpp
+ * @brief Shadow register for batching on/off outputs on one GPIO port
+ *
+ * Per-pin drivers cost one driver call and one register write per fan per
+ * cycle. A GpioPort keeps the desired pin levels in a shadow word that
+ * GpioFan (or anything else) sets and clears freely; commit() then writes
+ * only the pins that changed since the last commit, as one set/clear mask
+ * pair (a single write to a BSRR-style register), and skips the write
+ * entirely when nothing changed. Pins the port never touched are left
+ * alone, so the port can share its pins with other functions.
+ *
+ * Call commit() once per cycle after all controllers have run, from the
+ * same thread. Pins are assumed low until first set (configure them as
+ * outputs, initially inactive).
+ */
+
+#include "drivers.hpp"
+#include <cstdint>
+
+class GpioPort {
+public:
+    /**
+     * @brief Port write counters
+     */
+    struct Stats {
+        uint32_t writes_issued = 0;     // Set/clear writes sent to the driver
+        uint32_t writes_suppressed = 0; // Commits with no pin changed
+    };
+
+    explicit GpioPort(GpioPortDriver& driver) : driver_(driver) {}
+
+    GpioPort(const GpioPort&) = delete;
+    GpioPort& operator=(const GpioPort&) = delete;
+
+    void set(uint32_t mask) { shadow_ |= mask; }
+    void clear(uint32_t mask) { shadow_ &= ~mask; }
+
+    /**
+     * @brief Desired level of the pins in @p mask (any set)
+     */
+    bool isSet(uint32_t mask) const { return (shadow_ & mask) != 0; }
+
+    /**
+     * @brief Write the pins changed since the last commit
+     * @return true if the driver was written
+     */
+    bool commit() {
+        uint32_t changed = shadow_ ^ committed_;
+        if (changed == 0) {
+            stats_.writes_suppressed++;
+            return false;
+        }
+        driver_.write(changed & shadow_, changed & ~shadow_);
+        committed_ = shadow_;
+        stats_.writes_issued++;
+        return true;
+    }
+
+    /**
+     * @brief Pins changed but not yet committed
+     */
+    uint32_t pending() const { return shadow_ ^ committed_; }
+
+    uint32_t shadow() const { return shadow_; }
+
+    const Stats& getStats() const { return stats_; }
+
+private:
+    GpioPortDriver& driver_;
+    uint32_t shadow_ = 0;
+    uint32_t committed_ = 0;
+    Stats stats_;
+};
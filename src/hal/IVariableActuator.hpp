@@ -30,6 +30,15 @@ public:
      */
     virtual bool isActive() const = 0;
 
+    /**
+     * @brief Get delivered airflow, for models of the plant
+     * @return Airflow percentage (0-100%); the output itself unless the
+     *         actuator knows its own response (e.g. a fan's duty curve)
+     */
+    virtual float getAirflow() const {
+        return getOutput();
+    }
+
     // Backward compatibility with existing IActuator interface
     virtual void activate() {
         setOutput(100.0f);
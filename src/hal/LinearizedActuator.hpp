@@ -0,0 +1,59 @@
+#pragma once
+
+/**
+ * @file LinearizedActuator.hpp
+ * @brief Variable actuator decorator that commands airflow instead of duty
+ *
+ * setOutput() takes the requested airflow percentage and forwards the duty
+ * cycle that produces it according to the fan model, so the controller
+ * drives an approximately linear plant. Wrapping a BasicVariableFan with
+ * a different curve than its own does not compile.
+ */
+
+#include "IVariableActuator.hpp"
+#include "FanLinearizer.hpp"
+#include <algorithm>
+#include <type_traits>
+
+template <typename FanCurve>
+class BasicVariableFan;
+
+template <typename Curve, std::size_t Points = 65>
+class LinearizedActuator : public IVariableActuator {
+private:
+    IVariableActuator& fan_;
+    float requested_airflow_ = 0.0f;
+
+public:
+    explicit LinearizedActuator(IVariableActuator& fan) : fan_(fan) {}
+
+    template <typename FanCurve>
+    explicit LinearizedActuator(BasicVariableFan<FanCurve>& fan) : fan_(fan) {
+        static_assert(std::is_same<FanCurve, Curve>::value,
+                      "Linearize with the curve the fan reports its airflow with");
+    }
+
+    void setOutput(float percent) override {
+        requested_airflow_ = std::max(0.0f, std::min(100.0f, percent));
+        fan_.setOutput(FanLinearizer<Curve, Points>::dutyFor(requested_airflow_));
+    }
+
+    /**
+     * @brief Get requested airflow (not the underlying duty)
+     * @return Airflow percentage (0-100%)
+     */
+    float getOutput() const override {
+        return requested_airflow_;
+    }
+
+    bool isActive() const override {
+        return fan_.isActive();
+    }
+
+    /**
+     * @brief Get the wrapped fan's delivered airflow
+     */
+    float getAirflow() const override {
+        return fan_.getAirflow();
+    }
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+/**
+ * @file NtcSensor.hpp
+ * @brief ISensor for an NTC thermistor divider on a single ADC channel
+ */
+
+#include "ISensor.hpp"
+#include "NtcThermistor.hpp"
+#include "drivers.hpp"
+#include "Trace.hpp"
+
+template <typename Table = Ntc10kTable>
+class NtcSensor : public ISensor {
+public:
+    explicit NtcSensor(AdcDriver& adc) : adc_(adc) {}
+
+    float readValue() override {
+        TEMPCTRL_TRACE_SCOPE("sensor_read");
+        return Table::toCelsius(adc_.readRaw());
+    }
+
+private:
+    AdcDriver& adc_;
+};
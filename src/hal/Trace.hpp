@@ -0,0 +1,25 @@
+#pragma once
+
+/**
+ * @file Trace.hpp
+ * @brief Compile-time trace points
+ *
+ * TEMPCTRL_TRACE_SCOPE("name") records the enclosing scope as one event
+ * when the simulation build defines TEMPCTRL_TRACE (see TraceRecorder.hpp).
+ * Otherwise it expands to nothing, so trace points cost nothing on target.
+ *
+ * Loops that run until Ctrl+C test TEMPCTRL_TRACE_STOP_REQUESTED() and
+ * return from main(), so the trace is written outside the signal handler.
+ */
+
+#if defined(TEMPCTRL_TRACE) && defined(SIMULATION_BUILD)
+    #include "TraceRecorder.hpp"
+    #define TEMPCTRL_TRACE_CONCAT_(a, b) a##b
+    #define TEMPCTRL_TRACE_CONCAT(a, b) TEMPCTRL_TRACE_CONCAT_(a, b)
+    #define TEMPCTRL_TRACE_SCOPE(name) \
+        TraceScope TEMPCTRL_TRACE_CONCAT(trace_scope_, __LINE__)(name)
+    #define TEMPCTRL_TRACE_STOP_REQUESTED() TraceRecorder::stopRequested()
+#else
+    #define TEMPCTRL_TRACE_SCOPE(name) ((void)0)
+    #define TEMPCTRL_TRACE_STOP_REQUESTED() false
+#endif
@@ -0,0 +1,184 @@
+#pragma once
+
+/**
+ * @file TraceRecorder.hpp
+ * @brief Per-thread event recorder with Chrome trace JSON export (simulation only)
+ *
+ * Each thread records complete events ("ph":"X") into its own fixed-size
+ * buffer, so recording never takes a lock or touches another thread's
+ * cache lines. Buffers are linked into a global list with a CAS push the
+ * first time a thread records, and are written out as a Chrome trace
+ * (chrome://tracing, ui.perfetto.dev) when the process exits normally.
+ *
+ * Simulations that run until Ctrl+C poll stopRequested() and return from
+ * main(): the SIGINT handler only sets a flag, as nothing else is safe in
+ * signal context. A second Ctrl+C quits at once without the trace.
+ *
+ * The output file is $TEMPCTRL_TRACE_FILE, or trace.json by default.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <signal.h>
+#include <unistd.h>
+
+class TraceRecorder {
+public:
+    static constexpr uint32_t kEventsPerThread = 1u << 16;
+
+    struct Event {
+        const char* name;
+        uint64_t begin_ns;
+        uint32_t duration_ns;
+    };
+
+    struct Buffer {
+        Event events[kEventsPerThread];
+        std::atomic<uint32_t> count{0};
+        uint32_t dropped = 0;
+        uint32_t tid = 0;
+        Buffer* next = nullptr;
+    };
+
+    static uint64_t nowNs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * @brief Record a complete event on the calling thread
+     */
+    static void record(const char* name, uint64_t begin_ns, uint64_t end_ns) {
+        Buffer& buf = threadBuffer();
+        uint32_t n = buf.count.load(std::memory_order_relaxed);
+        if (n >= kEventsPerThread) {
+            buf.dropped++;
+            return;
+        }
+        buf.events[n] = Event{name, begin_ns, static_cast<uint32_t>(end_ns - begin_ns)};
+        // Publish the slot to a concurrent flush
+        buf.count.store(n + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Write every thread's events as Chrome trace JSON
+     * @param path Output file
+     * @return true on success
+     */
+    static bool writeChromeJson(const char* path) {
+        FILE* out = fopen(path, "w");
+        if (out == nullptr) return false;
+
+        const uint64_t origin = state().origin_ns;
+        fprintf(out, "{\"traceEvents\":[\n");
+        bool first = true;
+        uint32_t dropped = 0;
+        for (Buffer* buf = state().head.load(std::memory_order_acquire); buf; buf = buf->next) {
+            uint32_t n = buf->count.load(std::memory_order_acquire);
+            for (uint32_t i = 0; i < n; ++i) {
+                const Event& e = buf->events[i];
+                fprintf(out, "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                        first ? "" : ",\n", e.name,
+                        // Signed: a scope can begin before the first thread registers
+                        static_cast<int64_t>(e.begin_ns - origin) / 1000.0, e.duration_ns / 1000.0, buf->tid);
+                first = false;
+            }
+            dropped += buf->dropped;
+        }
+        fprintf(out, "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":%u}}\n", dropped);
+        return fclose(out) == 0;
+    }
+
+    /**
+     * @brief Ctrl+C was pressed since the first event was recorded
+     */
+    static bool stopRequested() {
+        return stop_requested_ != 0;
+    }
+
+    /**
+     * @brief Turn the trace file written at exit on or off (on by default);
+     *        for callers that write it themselves with writeChromeJson()
+     */
+    static void setExitFlush(bool enabled) {
+        state().exit_flush.store(enabled, std::memory_order_relaxed);
+    }
+
+private:
+    struct State {
+        std::atomic<Buffer*> head{nullptr};
+        std::atomic<uint32_t> next_tid{1};
+        std::atomic<bool> exit_hooked{false};
+        std::atomic<bool> exit_flush{true};
+        uint64_t origin_ns = nowNs();
+    };
+
+    static State& state() {
+        static State s;
+        return s;
+    }
+
+    static inline volatile std::sig_atomic_t stop_requested_ = 0;
+
+    static Buffer& threadBuffer() {
+        thread_local Buffer* buf = registerThread();
+        return *buf;
+    }
+
+    static Buffer* registerThread() {
+        // Buffers live until exit so the flush can read them after threads end
+        Buffer* buf = new Buffer();
+        buf->tid = state().next_tid.fetch_add(1, std::memory_order_relaxed);
+        Buffer* head = state().head.load(std::memory_order_relaxed);
+        do {
+            buf->next = head;
+        } while (!state().head.compare_exchange_weak(head, buf, std::memory_order_release,
+                                                     std::memory_order_relaxed));
+        hookExit();
+        return buf;
+    }
+
+    static void hookExit() {
+        if (state().exit_hooked.exchange(true)) return;
+        std::atexit(flushAtExit);
+        struct sigaction action = {};
+        action.sa_handler = onInterrupt;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGINT, &action, nullptr);
+    }
+
+    static void onInterrupt(int) {
+        // Async-signal-safe only: the main loop sees the flag and returns
+        if (stop_requested_) _exit(130);
+        stop_requested_ = 1;
+    }
+
+    static void flushAtExit() {
+        if (!state().exit_flush.load(std::memory_order_relaxed)) return;
+        const char* path = std::getenv("TEMPCTRL_TRACE_FILE");
+        if (path == nullptr) path = "trace.json";
+        if (writeChromeJson(path)) {
+            fprintf(stderr, "[TRACE] wrote %s\n", path);
+        }
+    }
+};
+
+/**
+ * @brief RAII scope that records one complete event
+ */
+class TraceScope {
+public:
+    explicit TraceScope(const char* name) : name_(name), begin_ns_(TraceRecorder::nowNs()) {}
+    ~TraceScope() { TraceRecorder::record(name_, begin_ns_, TraceRecorder::nowNs()); }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name_;
+    uint64_t begin_ns_;
+};
@@ -1,6 +1,7 @@
 #pragma once
 #include "ILogger.hpp"
 #include "drivers.hpp"
+#include "Trace.hpp"
 #include <cstdio>
 
 class UartLogger : public ILogger {
@@ -9,6 +10,7 @@ public:
     void log(float val) override {
         char buf[64];
         snprintf(buf, sizeof(buf), "Temp=%.2f°C\n", val);
+        TEMPCTRL_TRACE_SCOPE("uart_write");
         uart_.write(buf);
     }
 private:
@@ -3,25 +3,79 @@
 /**
  * @file VariableFan.hpp
  * @brief Variable-speed fan implementation using PWM control
+ *
+ * The fan's airflow model (FanCurve.hpp) is a template parameter, so
+ * getAirflow() and anything linearizing the fan use the same curve.
+ * VariableFan is the default quadratic fan.
  */
 
 #include "IVariableActuator.hpp"
+#include "FanCurve.hpp"
+#include "drivers.hpp"
+#include "Trace.hpp"
 #include <algorithm>
+#include <cstdint>
+
+template <typename FanCurve = QuadraticFanCurve>
+class BasicVariableFan : public IVariableActuator {
+public:
+    /**
+     * @brief Airflow model of this fan (see FanCurve.hpp)
+     */
+    using Curve = FanCurve;
+
+    /**
+     * @brief PWM register traffic counters
+     */
+    struct PwmStats {
+        uint32_t writes_issued = 0;     // Compare-register writes sent to the driver
+        uint32_t writes_suppressed = 0; // Updates skipped because the quantized duty was unchanged
+    };
 
-class VariableFan : public IVariableActuator {
 private:
     float current_output_ = 0.0f;
+    PwmDriver* pwm_ = nullptr;
+    uint32_t pulse_cycles_ = 0;
+    bool pwm_written_ = false;
+    PwmStats pwm_stats_;
 
 public:
+    /**
+     * @brief Construct fan without hardware (output is only stored)
+     */
+    BasicVariableFan() = default;
+
+    /**
+     * @brief Construct fan driving a PWM channel
+     * @param pwm PWM driver; duty is quantized to its period resolution
+     */
+    explicit BasicVariableFan(PwmDriver& pwm) : pwm_(&pwm) {}
+
     void setOutput(float percent) override {
+        TEMPCTRL_TRACE_SCOPE("actuator_write");
+
         // Clamp to valid range
         current_output_ = std::max(0.0f, std::min(100.0f, percent));
-        
-        // In a real implementation, this would set PWM duty cycle
-        // For simulation, we'll just store the value
-        
-        // Example pseudo-code for real hardware:
-        // pwm_set_duty_cycle(PWM_CHANNEL_FAN, current_output_);
+
+        if (pwm_ == nullptr) {
+            return;
+        }
+
+        // Quantize to timer resolution; the register only changes when the
+        // quantized pulse does, so identical updates never reach the bus
+        uint32_t period = pwm_->getPeriodCycles();
+        uint32_t pulse = static_cast<uint32_t>(current_output_ * period / 100.0f + 0.5f);
+        pulse = std::min(pulse, period);
+
+        if (pwm_written_ && pulse == pulse_cycles_) {
+            pwm_stats_.writes_suppressed++;
+            return;
+        }
+
+        pwm_->setPulseCycles(pulse);
+        pulse_cycles_ = pulse;
+        pwm_written_ = true;
+        pwm_stats_.writes_issued++;
     }
 
     float getOutput() const override {
@@ -33,6 +87,22 @@ public:
     }
 
     // Additional methods for fan-specific functionality
+
+    /**
+     * @brief Get last pulse width written to the PWM driver
+     * @return Pulse width in timer cycles
+     */
+    uint32_t getPulseCycles() const {
+        return pulse_cycles_;
+    }
+
+    /**
+     * @brief Get PWM write/suppression counters
+     * @return Current counters
+     */
+    const PwmStats& getPwmStats() const {
+        return pwm_stats_;
+    }
     
     /**
      * @brief Get fan speed level description
@@ -50,13 +120,11 @@ public:
      * @brief Get estimated airflow (for simulation/monitoring)
      * @return Relative airflow (0-100 arbitrary units)
      */
-    float getAirflow() const {
+    float getAirflow() const override {
         // Non-linear relationship: airflow doesn't scale linearly with PWM
-        // This simulates real fan behavior
-        if (current_output_ < 5.0f) return 0.0f;
-        
-        // Minimum start-up threshold + non-linear scaling
-        float effective_output = std::max(0.0f, current_output_ - 5.0f) / 95.0f;
-        return effective_output * effective_output * 100.0f; // Quadratic relationship
+        // (start-up dead zone, then the curve's response)
+        return Curve::airflow(current_output_);
     }
 };
+
+using VariableFan = BasicVariableFan<>;
@@ -8,6 +8,7 @@
     // Don't define anything here to avoid conflicts
 #elif SIMULATION_BUILD
     // Simulation drivers (uses console/mock hardware)
+    #include <cstddef>
     #include <cstdint>
     #include <cstdio>
     
@@ -28,26 +29,204 @@
     class GpioDriver {
     private:
         bool pin_state = false;
+        bool echo_ = true;
+        uint32_t write_count_ = 0;
     public:
         void setHigh() {
             pin_state = true;
-            printf("[GPIO] Fan ON\n");
+            write_count_++;
+            if (echo_) printf("[GPIO] Fan ON\n");
         }
         
         void setLow() {
             pin_state = false;
-            printf("[GPIO] Fan OFF\n");
+            write_count_++;
+            if (echo_) printf("[GPIO] Fan OFF\n");
         }
         
         bool getState() const { return pin_state; }
+
+        // Silence console output (many fans, benchmarks)
+        void setEcho(bool echo) { echo_ = echo; }
+        uint32_t getWriteCount() const { return write_count_; }
+    };
+
+    class GpioPortDriver {
+        // 32-pin output port with set/clear registers (one bus write sets and clears any pins)
+    private:
+        uint32_t state_ = 0;
+        uint32_t write_count_ = 0;
+    public:
+        void write(uint32_t set, uint32_t clear) {
+            state_ = (state_ | set) & ~clear;
+            write_count_++;
+        }
+
+        uint32_t getState() const { return state_; }
+        uint32_t getWriteCount() const { return write_count_; }
     };
     
     class UartDriver {
+    private:
+        bool echo_ = true;
     public:
         void write(const char* msg) {
+            if (!echo_) return;
             printf("[UART] %s", msg);
             fflush(stdout);
         }
+
+        // Binary frames (command protocol replies): to the sink if set
+        // (e.g. a pty standing in for the serial link), else summarised
+        void writeBytes(const uint8_t* data, size_t size) {
+            if (sink_) {
+                fwrite(data, 1, size, sink_);
+                fflush(sink_);
+            } else if (echo_) {
+                printf("[UART] <%zu binary bytes>\n", size);
+            }
+        }
+
+        // Silence console output (long or many-controller simulations)
+        void setEcho(bool echo) { echo_ = echo; }
+        void setBinarySink(FILE* sink) { sink_ = sink; }
+
+    private:
+        FILE* sink_ = nullptr;
+    };
+
+    class PwmDriver {
+    private:
+        uint32_t period_cycles_;
+        uint32_t pulse_cycles_ = 0;
+        uint32_t write_count_ = 0;
+    public:
+        explicit PwmDriver(uint32_t period_cycles = 1000) : period_cycles_(period_cycles) {}
+
+        uint32_t getPeriodCycles() const { return period_cycles_; }
+
+        void setPulseCycles(uint32_t pulse) {
+            // Each call models one compare-register write on the bus
+            pulse_cycles_ = pulse;
+            write_count_++;
+        }
+
+        uint32_t getPulseCycles() const { return pulse_cycles_; }
+        uint32_t getWriteCount() const { return write_count_; }
+    };
+
+    class AdcScanDriver {
+    public:
+        static constexpr size_t kMaxChannels = 16;
+
+        /**
+         * Timing model: every driver transaction pays a fixed setup cost
+         * (call, trigger, completion interrupt), each conversion pays the
+         * sample-and-hold plus conversion time.
+         */
+        struct Timing {
+            uint32_t transaction_ns = 15000;
+            uint32_t conversion_ns = 2000;
+        };
+
+        AdcScanDriver() = default;
+        explicit AdcScanDriver(const Timing& timing) : timing_(timing) {}
+
+        // Channels must be unique and ascending (hardware sequencer order)
+        bool configure(const uint8_t* channels, size_t count) {
+            if (count == 0 || count > kMaxChannels) return false;
+            for (size_t i = 0; i < count; i++) {
+                if (channels[i] >= kMaxChannels) return false;
+                if (i > 0 && channels[i] <= channels[i - 1]) return false;
+                channels_[i] = channels[i];
+            }
+            count_ = count;
+            return true;
+        }
+
+        // One conversion burst; samples land in @p out as if by DMA
+        bool scan(uint16_t* out) {
+            if (count_ == 0) return false;
+            for (size_t i = 0; i < count_; i++) {
+                out[i] = sample(channels_[i]);
+            }
+            elapsed_ns_ += timing_.transaction_ns + count_ * timing_.conversion_ns;
+            transactions_++;
+            return true;
+        }
+
+        // Single blocking conversion, one transaction per call
+        uint16_t readChannel(uint8_t channel) {
+            elapsed_ns_ += timing_.transaction_ns + timing_.conversion_ns;
+            transactions_++;
+            return sample(channel);
+        }
+
+        uint64_t getElapsedNs() const { return elapsed_ns_; }
+        uint32_t getTransactionCount() const { return transactions_; }
+
+    private:
+        // Each channel idles at its own temperature (about 25-37 °C) with a slow ripple
+        uint16_t sample(uint8_t channel) {
+            uint32_t phase = (ticks_[channel]++ / 4) % 16;
+            return static_cast<uint16_t>(310 + channel * 10 + (phase < 8 ? phase : 15 - phase));
+        }
+
+        Timing timing_;
+        uint8_t channels_[kMaxChannels] = {};
+        size_t count_ = 0;
+        uint32_t ticks_[kMaxChannels] = {};
+        uint64_t elapsed_ns_ = 0;
+        uint32_t transactions_ = 0;
+    };
+
+    class SettingsDriver {
+        // Flash settings emulated with one file per key in a directory
+    public:
+        explicit SettingsDriver(const char* directory = ".") : directory_(directory) {}
+
+        // Whole-record replace; the rename makes it atomic like a flash record
+        bool save(const char* key, const void* data, size_t size) {
+            char path[256];
+            char temp[264];
+            filePath(key, path, sizeof(path));
+            snprintf(temp, sizeof(temp), "%s.tmp", path);
+            FILE* out = fopen(temp, "wb");
+            if (!out) return false;
+            bool ok = fwrite(data, 1, size, out) == size;
+            ok = fclose(out) == 0 && ok;
+            if (!ok || rename(temp, path) != 0) return false;
+            writes_++;
+            bytes_written_ += size;
+            return true;
+        }
+
+        // Bytes read into @p data (at most @p size), 0 if the key is missing
+        size_t load(const char* key, void* data, size_t size) {
+            char path[256];
+            filePath(key, path, sizeof(path));
+            FILE* in = fopen(path, "rb");
+            if (!in) return 0;
+            size_t read = fread(data, 1, size, in);
+            fclose(in);
+            return read;
+        }
+
+        uint32_t getWriteCount() const { return writes_; }
+        uint64_t getBytesWritten() const { return bytes_written_; }
+
+    private:
+        void filePath(const char* key, char* path, size_t size) const {
+            int n = snprintf(path, size, "%s/", directory_);
+            for (size_t i = 0; key[i] != '\0' && n > 0 && static_cast<size_t>(n) + 1 < size; i++) {
+                path[n++] = key[i] == '/' ? '_' : key[i];
+            }
+            path[n] = '\0';
+        }
+
+        const char* directory_;
+        uint32_t writes_ = 0;
+        uint64_t bytes_written_ = 0;
     };
 
 #else
@@ -66,11 +245,127 @@
         void setHigh();
         void setLow();
     };
+
+    #include <drivers/gpio.h>
+
+    class GpioPortDriver {
+        // Zephyr GPIO port; pins configured as outputs, initially low
+    public:
+        explicit GpioPortDriver(const struct device* port) : port_(port) {}
+
+        void write(uint32_t set, uint32_t clear) {
+            gpio_port_set_clr_bits_raw(port_, set, clear);
+        }
+
+    private:
+        const struct device* port_;
+    };
     
+    class ByteRing;
+
     class UartDriver {
         // Real Zephyr UART implementation
     public:
         void write(const char* msg);
+        void writeBytes(const uint8_t* data, size_t size);
+        // RX interrupt pushes received bytes into @p ring
+        void startReceive(ByteRing& ring);
+    };
+
+    #include <drivers/pwm.h>
+
+    class PwmDriver {
+        // Zephyr PWM channel; period is fixed, pulse is in timer cycles
+    public:
+        PwmDriver(const struct device* dev, uint32_t channel, uint32_t period_cycles)
+            : dev_(dev), channel_(channel), period_cycles_(period_cycles) {}
+
+        uint32_t getPeriodCycles() const { return period_cycles_; }
+
+        void setPulseCycles(uint32_t pulse) {
+            pwm_pin_set_cycles(dev_, channel_, period_cycles_, pulse, 0);
+        }
+
+    private:
+        const struct device* dev_;
+        uint32_t channel_;
+        uint32_t period_cycles_;
+    };
+
+    #include <drivers/adc.h>
+
+    class AdcScanDriver {
+        // Zephyr ADC sequence: all channels converted in one adc_read() call
+    public:
+        static constexpr size_t kMaxChannels = 16;
+
+        explicit AdcScanDriver(const struct device* dev) : dev_(dev) {}
+
+        // Channels must be unique and ascending: Zephyr stores samples in channel-ID order
+        bool configure(const uint8_t* channels, size_t count) {
+            if (count == 0 || count > kMaxChannels) return false;
+            uint32_t mask = 0;
+            for (size_t i = 0; i < count; i++) {
+                if (channels[i] >= kMaxChannels) return false;
+                if (i > 0 && channels[i] <= channels[i - 1]) return false;
+                struct adc_channel_cfg cfg = {};
+                cfg.gain = ADC_GAIN_1;
+                cfg.reference = ADC_REF_INTERNAL;
+                cfg.acquisition_time = ADC_ACQ_TIME_DEFAULT;
+                cfg.channel_id = channels[i];
+                if (adc_channel_setup(dev_, &cfg) != 0) return false;
+                mask |= 1u << channels[i];
+            }
+            count_ = count;
+            sequence_ = {};
+            sequence_.channels = mask;
+            sequence_.resolution = 12;
+            return true;
+        }
+
+        bool scan(uint16_t* out) {
+            if (count_ == 0) return false;
+            sequence_.buffer = out;
+            sequence_.buffer_size = count_ * sizeof(uint16_t);
+            return adc_read(dev_, &sequence_) == 0;
+        }
+
+    private:
+        const struct device* dev_;
+        struct adc_sequence sequence_ = {};
+        size_t count_ = 0;
+    };
+
+    #include <settings/settings.h>
+
+    class SettingsDriver {
+        // Zephyr settings subsystem (NVS backend); call settings_subsys_init() first
+    public:
+        bool save(const char* key, const void* data, size_t size) {
+            return settings_save_one(key, data, size) == 0;
+        }
+
+        size_t load(const char* key, void* data, size_t size) {
+            LoadTarget target{data, size, 0};
+            settings_load_subtree_direct(key, onLoad, &target);
+            return target.read;
+        }
+
+    private:
+        struct LoadTarget {
+            void* data;
+            size_t size;
+            size_t read;
+        };
+
+        // Called for the exact key only ("name" is the remainder, empty here)
+        static int onLoad(const char* name, size_t len, settings_read_cb read_cb, void* cb_arg, void* param) {
+            if (name != nullptr && name[0] != '\0') return 0;
+            LoadTarget* target = static_cast<LoadTarget*>(param);
+            ssize_t n = read_cb(cb_arg, target->data, len < target->size ? len : target->size);
+            target->read = n > 0 ? static_cast<size_t>(n) : 0;
+            return 0;
+        }
     };
 
 #endif
@@ -1,9 +1,28 @@
 #include <zephyr.h>
 #include "AdcSensor.hpp"
-#include "GpioFan.hpp"
 #include "UartLogger.hpp"
+#include "PeriodicScheduler.hpp"
+
+// Default firmware: on/off GPIO fan with the hysteresis controller. The PID
+// firmware (PWM fan, UART commands, adaptive sampling) needs board support
+// and is opt-in, see CMakeLists.txt:
+//   TEMPCTRL_PWM_FAN     devicetree alias "fan-pwm" for the fan's PWM channel
+//   TEMPCTRL_EVENT_MODE  send-on-delta regulation (with TEMPCTRL_PWM_FAN)
+//   TEMPCTRL_WARM_START  settings in NVS; needs a "storage_partition"
+
+#ifndef TEMPCTRL_PWM_FAN
+
+#include "GpioFan.hpp"
 #include "TemperatureController.hpp"
 
+namespace {
+
+void control(void* context, uint64_t) {
+    static_cast<TemperatureController*>(context)->regulate();
+}
+
+} // namespace
+
 extern "C" void main(void) {
     static AdcDriver adc;
     static GpioDriver gpio;
@@ -15,8 +34,138 @@ extern "C" void main(void) {
 
     TemperatureController controller(sensor, fan, logger);
 
+    // Once a second on an absolute grid: run time never adds drift
+    static PeriodicScheduler scheduler;
+    scheduler.add("control", 1000 * 1000, control, &controller);
+    scheduler.start();
+
+    while (true) {
+        scheduler.runDue();
+        k_sleep(K_TIMEOUT_ABS_US(scheduler.nextRelease()));
+    }
+}
+
+#else
+
+#include <device.h>
+#include <devicetree.h>
+#include "VariableFan.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "AdaptiveSampler.hpp"
+#include "WarmStartStore.hpp"
+#include "ByteRing.hpp"
+#include "CommandProtocol.hpp"
+#include <cstdio>
+
+// Fan PWM channel from the devicetree alias "fan-pwm", driven at 25 kHz
+#define FAN_PWM_CHANNEL 0
+#define FAN_PWM_FREQUENCY_HZ 25000
+
+namespace {
+
+struct Loop {
+    AdvancedTemperatureController& controller;
+    AdaptiveSampler& sampler;
+    CommandServer& commands;
+    UartDriver& uart;
+    PeriodicScheduler& scheduler;
+    int control_id = -1;
+    uint64_t last_release_us = 0;
+};
+
+void pollCommands(void* context, uint64_t release_us) {
+    Loop* loop = static_cast<Loop*>(context);
+    uint32_t now_ms = static_cast<uint32_t>(release_us / 1000);
+    CommandServer::PollResult result;
+    do {
+        result = loop->commands.poll(now_ms);
+    } while (result == CommandServer::PollResult::Frame || result == CommandServer::PollResult::Busy);
+}
+
+void control(void* context, uint64_t release_us) {
+    Loop* loop = static_cast<Loop*>(context);
+    // Releases are on the grid, so their spacing is the exact sample interval
+    float dt = loop->last_release_us ? (release_us - loop->last_release_us) / 1e6f
+                                     : loop->sampler.getPeriodMs() / 1000.0f;
+    loop->last_release_us = release_us;
+
+    loop->controller.regulate(dt);
+    float temp = loop->controller.getStatistics().last_temp;
+    loop->commands.recordSample(temp);
+
+    uint32_t period_ms = loop->sampler.next(temp, loop->controller.getPIDState().error, dt);
+    loop->scheduler.setPeriod(loop->control_id, period_ms * 1000);
+}
+
+void report(void* context, uint64_t) {
+    Loop* loop = static_cast<Loop*>(context);
+    char line[96];
+    for (size_t id = 0; id < loop->scheduler.size(); id++) {
+        const PeriodicScheduler::TaskStats& stats = loop->scheduler.getStats(static_cast<int>(id));
+        snprintf(line, sizeof(line), "[sched] %s: %u runs, %u overruns, %u skipped, p99 %u us\r\n",
+                 loop->scheduler.name(static_cast<int>(id)), stats.runs, stats.overruns, stats.skipped,
+                 stats.latency_us.percentile(99.0f));
+        loop->uart.write(line);
+    }
+}
+
+} // namespace
+
+extern "C" void main(void) {
+    static AdcDriver adc;
+    static UartDriver uart;
+
+    const struct device* pwm_dev = DEVICE_DT_GET(DT_ALIAS(fan_pwm));
+    uint64_t pwm_cycles_per_sec = 0;
+    pwm_get_cycles_per_sec(pwm_dev, FAN_PWM_CHANNEL, &pwm_cycles_per_sec);
+    static PwmDriver pwm(pwm_dev, FAN_PWM_CHANNEL,
+                         static_cast<uint32_t>(pwm_cycles_per_sec / FAN_PWM_FREQUENCY_HZ));
+
+    AdcSensor sensor(adc);
+    VariableFan fan(pwm);
+    UartLogger logger(uart);
+
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+
+#ifdef TEMPCTRL_WARM_START
+    // Resume the saved gains, setpoint and integral after a reset
+    settings_subsys_init();
+    static SettingsDriver settings;
+    static WarmStartStore warm_start(settings);
+    controller.enableWarmStart(warm_start);
+#endif
+
+    // Framed binary commands (setpoint, gains, stats, history) on the same UART
+    static StaticByteRing<256> uart_rx;
+    static CommandServer commands(uart_rx, uart, controller);
+    uart.startReceive(uart_rx);
+
+#ifdef TEMPCTRL_EVENT_MODE
+    // Only run PID/actuator/logging when the temperature moves
+    AdvancedTemperatureController::EventConfig events;
+    events.enabled = true;
+    events.deadband = 0.2f;
+    events.max_silent_cycles = 60;
+    controller.setEventMode(events);
+#endif
+
+    // Sample faster during transients, sleep longer (tickless) when stable
+    static AdaptiveSampler sampler;
+
+    // Commands every 20 ms, control at the sampler's period, a status line
+    // every minute; releases are absolute, so run time never adds drift
+    static PeriodicScheduler scheduler;
+    static Loop loop{controller, sampler, commands, uart, scheduler};
+    scheduler.add("commands", 20 * 1000, pollCommands, &loop);
+    loop.control_id = scheduler.add("control", sampler.getPeriodMs() * 1000, control, &loop, 1000);
+    scheduler.add("report", 60 * 1000 * 1000, report, &loop, 5000);
+    scheduler.start();
+
     while (true) {
-        controller.regulate();
-        k_sleep(K_SECONDS(1));
+        scheduler.runDue();
+        k_sleep(K_TIMEOUT_ABS_US(scheduler.nextRelease()));
     }
 }
+
+#endif // TEMPCTRL_PWM_FAN
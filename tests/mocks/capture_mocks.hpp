@@ -0,0 +1,184 @@
+#pragma once
+
+/**
+ * @file capture_mocks.hpp
+ * @brief High-volume mock drivers for soak tests
+ *
+ * The fakes in fff_mocks.hpp keep at most 50 calls and MockUartDriver
+ * allocates a std::string per message. These drivers allocate all their
+ * storage once at construction. They keep the most recent calls in ring
+ * buffers, plus running counters that cover every call. A test can run
+ * millions of cycles without malloc and still inspect the tail of the
+ * history.
+ */
+
+#include "fff_mocks.hpp"
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+
+/**
+ * @brief Fixed-capacity ring that keeps the most recent values
+ *
+ * Capacity is rounded up to a power of two so indexing is a mask.
+ */
+template<typename T>
+class CaptureRing {
+public:
+    explicit CaptureRing(size_t capacity)
+        : capacity_(roundUpPow2(capacity)), data_(new T[capacity_]()) {}
+
+    void push(const T& value) {
+        next() = value;
+    }
+
+    /**
+     * @brief Claim the next slot for in-place filling (counts as a push)
+     */
+    T& next() {
+        return data_[total_++ & (capacity_ - 1)];
+    }
+
+    /**
+     * @brief Value @p age calls back (0 = most recent); requires age < size()
+     */
+    const T& recent(size_t age = 0) const {
+        return data_[(total_ - 1 - age) & (capacity_ - 1)];
+    }
+
+    size_t size() const { return total_ < capacity_ ? total_ : capacity_; }
+    size_t capacity() const { return capacity_; }
+    uint64_t total() const { return total_; }
+    uint64_t overwritten() const { return total_ - size(); }
+
+    void clear() { total_ = 0; }
+
+private:
+    static size_t roundUpPow2(size_t n) {
+        size_t p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    size_t capacity_;
+    std::unique_ptr<T[]> data_;
+    uint64_t total_ = 0;
+};
+
+/**
+ * @brief ADC driver that streams readings from a generator or a recording
+ */
+class StreamAdcDriver : public AdcDriver {
+public:
+    using Generator = std::function<uint16_t(uint64_t index)>;
+
+    explicit StreamAdcDriver(Generator generator) : generator_(std::move(generator)) {}
+
+    /**
+     * @brief Replay raw readings from a text file (one value per line), looping
+     * @return Driver with no samples (reads return 0) if the file is unreadable
+     */
+    static StreamAdcDriver fromFile(const char* path) {
+        std::shared_ptr<std::vector<uint16_t>> samples = std::make_shared<std::vector<uint16_t>>();
+        if (FILE* in = fopen(path, "r")) {
+            unsigned value = 0;
+            while (fscanf(in, "%u", &value) == 1) {
+                samples->push_back(static_cast<uint16_t>(value));
+            }
+            fclose(in);
+        }
+        return StreamAdcDriver([samples](uint64_t i) -> uint16_t {
+            return samples->empty() ? 0 : (*samples)[i % samples->size()];
+        });
+    }
+
+    uint16_t readRaw() override {
+        uint16_t raw = generator_(reads_++);
+        last_ = raw;
+        return raw;
+    }
+
+    uint64_t getReadCount() const { return reads_; }
+    uint16_t getLastRaw() const { return last_; }
+
+private:
+    Generator generator_;
+    uint64_t reads_ = 0;
+    uint16_t last_ = 0;
+};
+
+/**
+ * @brief UART driver that copies messages into preallocated fixed-size slots
+ *
+ * Messages longer than kSlotSize - 1 are truncated in the ring, but the
+ * byte counter still covers their full length.
+ */
+class RingUartDriver : public UartDriver {
+public:
+    static constexpr size_t kSlotSize = 64;
+
+    struct Slot {
+        char text[kSlotSize];
+    };
+
+    explicit RingUartDriver(size_t capacity = 1024) : slots_(capacity) {}
+
+    void write(const char* msg) override {
+        size_t len = strlen(msg);
+        size_t copied = len < kSlotSize - 1 ? len : kSlotSize - 1;
+        Slot& slot = slots_.next();
+        memcpy(slot.text, msg, copied);
+        slot.text[copied] = '\0';
+        bytes_ += len;
+    }
+
+    void writeBytes(const uint8_t*, size_t size) override {
+        bytes_ += size;
+    }
+
+    /**
+     * @brief Message @p age writes back (0 = most recent), "" if not retained
+     */
+    const char* recent(size_t age = 0) const {
+        return age < slots_.size() ? slots_.recent(age).text : "";
+    }
+
+    uint64_t getMessageCount() const { return slots_.total(); }
+    uint64_t getByteCount() const { return bytes_; }
+    const CaptureRing<Slot>& messages() const { return slots_; }
+
+private:
+    CaptureRing<Slot> slots_;
+    uint64_t bytes_ = 0;
+};
+
+/**
+ * @brief PWM driver that records pulse writes with running min/max
+ */
+class RingPwmDriver : public PwmDriver {
+public:
+    explicit RingPwmDriver(uint32_t period_cycles = 1000, size_t capacity = 1024)
+        : period_cycles_(period_cycles), pulses_(capacity) {}
+
+    uint32_t getPeriodCycles() const override {
+        return period_cycles_;
+    }
+
+    void setPulseCycles(uint32_t pulse) override {
+        pulses_.push(pulse);
+        if (pulse < min_) min_ = pulse;
+        if (pulse > max_) max_ = pulse;
+    }
+
+    uint64_t getWriteCount() const { return pulses_.total(); }
+    uint32_t getMinPulse() const { return min_; }
+    uint32_t getMaxPulse() const { return max_; }
+    const CaptureRing<uint32_t>& pulses() const { return pulses_; }
+
+private:
+    uint32_t period_cycles_;
+    CaptureRing<uint32_t> pulses_;
+    uint32_t min_ = UINT32_MAX;
+    uint32_t max_ = 0;
+};
@@ -1,14 +1,15 @@
 #include "fff_mocks.hpp"
 
-// Define FFF globals here (only once)
+// Define FFF globals here (only once). Fake state is thread_local so the
+// parallel runner gives each worker its own, reset before every test.
 fff_globals_t fff = {0};
 
 // Manual fake function implementations (instead of complex macros)
 
 // ADC fake function
-adc_read_raw_fake_t adc_read_raw_fake = {0};
-uint16_t adc_read_raw_return_val = 0;
-unsigned int adc_read_raw_call_count = 0;
+thread_local adc_read_raw_fake_t adc_read_raw_fake = {0};
+thread_local uint16_t adc_read_raw_return_val = 0;
+thread_local unsigned int adc_read_raw_call_count = 0;
 
 uint16_t adc_read_raw(void) {
     adc_read_raw_call_count++;
@@ -33,19 +34,19 @@ void adc_read_raw_reset(void) {
 }
 
 // GPIO fake functions
-gpio_set_high_fake_t gpio_set_high_fake = {0};
-unsigned int gpio_set_high_call_count = 0;
+thread_local gpio_set_high_fake_t gpio_set_high_fake = {0};
+thread_local unsigned int gpio_set_high_call_count = 0;
 void gpio_set_high(void) { gpio_set_high_call_count++; gpio_set_high_fake.call_count++; }
 void gpio_set_high_reset(void) { gpio_set_high_call_count = 0; gpio_set_high_fake.call_count = 0; }
 
-gpio_set_low_fake_t gpio_set_low_fake = {0};
-unsigned int gpio_set_low_call_count = 0;
+thread_local gpio_set_low_fake_t gpio_set_low_fake = {0};
+thread_local unsigned int gpio_set_low_call_count = 0;
 void gpio_set_low(void) { gpio_set_low_call_count++; gpio_set_low_fake.call_count++; }
 void gpio_set_low_reset(void) { gpio_set_low_call_count = 0; gpio_set_low_fake.call_count = 0; }
 
-gpio_get_state_fake_t gpio_get_state_fake = {0};
-bool gpio_get_state_return_val = false;
-unsigned int gpio_get_state_call_count = 0;
+thread_local gpio_get_state_fake_t gpio_get_state_fake = {0};
+thread_local bool gpio_get_state_return_val = false;
+thread_local unsigned int gpio_get_state_call_count = 0;
 bool gpio_get_state(void) { 
     gpio_get_state_call_count++; 
     gpio_get_state_fake.call_count++; 
@@ -59,9 +60,9 @@ void gpio_get_state_reset(void) {
 }
 
 // UART fake function
-uart_write_fake_t uart_write_fake = {0};
-unsigned int uart_write_call_count = 0;
-const char* uart_write_arg0_history[50];
+thread_local uart_write_fake_t uart_write_fake = {0};
+thread_local unsigned int uart_write_call_count = 0;
+thread_local const char* uart_write_arg0_history[50];
 
 void uart_write(const char* arg0) {
     if(uart_write_call_count < 50) {
@@ -77,10 +78,26 @@ void uart_write_reset(void) {
     uart_write_fake.call_count = 0;
 }
 
+// PWM fake function
+thread_local pwm_set_pulse_cycles_fake_t pwm_set_pulse_cycles_fake = {};
+
+void pwm_set_pulse_cycles(uint32_t arg0) {
+    if(pwm_set_pulse_cycles_fake.call_count < 50) {
+        pwm_set_pulse_cycles_fake.arg0_history[pwm_set_pulse_cycles_fake.call_count] = arg0;
+    }
+    pwm_set_pulse_cycles_fake.arg0_val = arg0;
+    pwm_set_pulse_cycles_fake.call_count++;
+}
+
+void pwm_set_pulse_cycles_reset(void) {
+    pwm_set_pulse_cycles_fake.call_count = 0;
+    pwm_set_pulse_cycles_fake.arg0_val = 0;
+}
+
 // Global mock instances
-MockAdcDriver mock_adc;
-MockGpioDriver mock_gpio;
-MockUartDriver mock_uart;
+thread_local MockAdcDriver mock_adc;
+thread_local MockGpioDriver mock_gpio;
+thread_local MockUartDriver mock_uart;
 
 // Reset all mocks function
 extern "C" void reset_all_mocks() {
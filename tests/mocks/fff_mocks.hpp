@@ -2,7 +2,11 @@
 
 #define FFF_INCLUDE_FFP_FUNC
 #include "../include/fff.h"
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <map>
 #include <vector>
 #include <string>
 
@@ -30,37 +34,48 @@ typedef struct {
     const char* arg0_history[50]; 
 } uart_write_fake_t;
 
+typedef struct { 
+    unsigned int call_count; 
+    uint32_t arg0_val; 
+    uint32_t arg0_history[50]; 
+} pwm_set_pulse_cycles_fake_t;
+
 // Mock function declarations for ADC driver
-extern adc_read_raw_fake_t adc_read_raw_fake;
-extern uint16_t adc_read_raw_return_val;
-extern unsigned int adc_read_raw_call_count;
+extern thread_local adc_read_raw_fake_t adc_read_raw_fake;
+extern thread_local uint16_t adc_read_raw_return_val;
+extern thread_local unsigned int adc_read_raw_call_count;
 uint16_t adc_read_raw(void);
 void adc_read_raw_reset(void);
 
 // Mock function declarations for GPIO driver  
-extern gpio_set_high_fake_t gpio_set_high_fake;
-extern unsigned int gpio_set_high_call_count;
+extern thread_local gpio_set_high_fake_t gpio_set_high_fake;
+extern thread_local unsigned int gpio_set_high_call_count;
 void gpio_set_high(void);
 void gpio_set_high_reset(void);
 
-extern gpio_set_low_fake_t gpio_set_low_fake;
-extern unsigned int gpio_set_low_call_count;
+extern thread_local gpio_set_low_fake_t gpio_set_low_fake;
+extern thread_local unsigned int gpio_set_low_call_count;
 void gpio_set_low(void);
 void gpio_set_low_reset(void);
 
-extern gpio_get_state_fake_t gpio_get_state_fake;
-extern bool gpio_get_state_return_val;
-extern unsigned int gpio_get_state_call_count;
+extern thread_local gpio_get_state_fake_t gpio_get_state_fake;
+extern thread_local bool gpio_get_state_return_val;
+extern thread_local unsigned int gpio_get_state_call_count;
 bool gpio_get_state(void);
 void gpio_get_state_reset(void);
 
 // Mock function declarations for UART driver
-extern uart_write_fake_t uart_write_fake;
-extern unsigned int uart_write_call_count;
-extern const char* uart_write_arg0_history[50];
+extern thread_local uart_write_fake_t uart_write_fake;
+extern thread_local unsigned int uart_write_call_count;
+extern thread_local const char* uart_write_arg0_history[50];
 void uart_write(const char* arg0);
 void uart_write_reset(void);
 
+// Mock function declarations for PWM driver
+extern thread_local pwm_set_pulse_cycles_fake_t pwm_set_pulse_cycles_fake;
+void pwm_set_pulse_cycles(uint32_t arg0);
+void pwm_set_pulse_cycles_reset(void);
+
 // Base driver classes (same interface as in src/hal/drivers.hpp)
 class AdcDriver {
 public:
@@ -76,12 +91,41 @@ public:
     virtual ~GpioDriver() = default;
 };
 
+class GpioPortDriver {
+public:
+    virtual void write(uint32_t set, uint32_t clear) = 0;
+    virtual ~GpioPortDriver() = default;
+};
+
 class UartDriver {
 public:
     virtual void write(const char* msg) = 0;
+    virtual void writeBytes(const uint8_t* data, size_t size) = 0;
     virtual ~UartDriver() = default;
 };
 
+class PwmDriver {
+public:
+    virtual uint32_t getPeriodCycles() const = 0;
+    virtual void setPulseCycles(uint32_t pulse) = 0;
+    virtual ~PwmDriver() = default;
+};
+
+class AdcScanDriver {
+public:
+    static constexpr size_t kMaxChannels = 16;
+    virtual bool configure(const uint8_t* channels, size_t count) = 0;
+    virtual bool scan(uint16_t* out) = 0;
+    virtual ~AdcScanDriver() = default;
+};
+
+class SettingsDriver {
+public:
+    virtual bool save(const char* key, const void* data, size_t size) = 0;
+    virtual size_t load(const char* key, void* data, size_t size) = 0;
+    virtual ~SettingsDriver() = default;
+};
+
 // Mock driver classes that inherit from base interfaces
 class MockAdcDriver : public AdcDriver {
 public:
@@ -105,9 +149,31 @@ public:
     }
 };
 
+class MockGpioPortDriver : public GpioPortDriver {
+private:
+    uint32_t state_ = 0;
+    uint32_t last_set_ = 0;
+    uint32_t last_clear_ = 0;
+    unsigned int write_count_ = 0;
+
+public:
+    void write(uint32_t set, uint32_t clear) override {
+        state_ = (state_ | set) & ~clear;
+        last_set_ = set;
+        last_clear_ = clear;
+        write_count_++;
+    }
+
+    uint32_t getState() const { return state_; }
+    uint32_t getLastSet() const { return last_set_; }
+    uint32_t getLastClear() const { return last_clear_; }
+    unsigned int getWriteCount() const { return write_count_; }
+};
+
 class MockUartDriver : public UartDriver {
 private:
     std::vector<std::string> captured_messages;
+    std::vector<uint8_t> captured_bytes;
     
 public:
     void write(const char* msg) override {
@@ -122,12 +188,108 @@ public:
     std::string getLastMessage() const {
         return captured_messages.empty() ? "" : captured_messages.back();
     }
+
+    void writeBytes(const uint8_t* data, size_t size) override {
+        captured_bytes.insert(captured_bytes.end(), data, data + size);
+    }
+
+    // Binary writes, concatenated
+    std::vector<uint8_t>& getBytes() {
+        return captured_bytes;
+    }
     
     void clear() {
         captured_messages.clear();
+        captured_bytes.clear();
     }
 };
 
+class MockPwmDriver : public PwmDriver {
+private:
+    uint32_t period_cycles_;
+
+public:
+    explicit MockPwmDriver(uint32_t period_cycles = 1000) : period_cycles_(period_cycles) {}
+
+    uint32_t getPeriodCycles() const override {
+        return period_cycles_;
+    }
+
+    void setPulseCycles(uint32_t pulse) override {
+        pwm_set_pulse_cycles(pulse);
+    }
+};
+
+class MockAdcScanDriver : public AdcScanDriver {
+private:
+    uint16_t values_[kMaxChannels] = {};
+    uint8_t channels_[kMaxChannels] = {};
+    size_t count_ = 0;
+    unsigned int configure_count_ = 0;
+    unsigned int scan_count_ = 0;
+    bool fail_ = false;
+
+public:
+    bool configure(const uint8_t* channels, size_t count) override {
+        configure_count_++;
+        if (count == 0 || count > kMaxChannels) return false;
+        for (size_t i = 0; i < count; i++) {
+            channels_[i] = channels[i];
+        }
+        count_ = count;
+        return true;
+    }
+
+    bool scan(uint16_t* out) override {
+        scan_count_++;
+        if (fail_ || count_ == 0) return false;
+        for (size_t i = 0; i < count_; i++) {
+            out[i] = values_[channels_[i]];
+        }
+        return true;
+    }
+
+    // Raw value returned for @p channel by subsequent scans
+    void setValue(uint8_t channel, uint16_t raw) { values_[channel] = raw; }
+    void setFailing(bool fail) { fail_ = fail; }
+
+    unsigned int getConfigureCount() const { return configure_count_; }
+    unsigned int getScanCount() const { return scan_count_; }
+};
+
+class MockSettingsDriver : public SettingsDriver {
+private:
+    std::map<std::string, std::vector<uint8_t>> records_;
+    unsigned int write_count_ = 0;
+    bool fail_ = false;
+
+public:
+    bool save(const char* key, const void* data, size_t size) override {
+        if (fail_) return false;
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        records_[key].assign(bytes, bytes + size);
+        write_count_++;
+        return true;
+    }
+
+    size_t load(const char* key, void* data, size_t size) override {
+        auto it = records_.find(key);
+        if (it == records_.end()) return 0;
+        size_t n = std::min(size, it->second.size());
+        memcpy(data, it->second.data(), n);
+        return n;
+    }
+
+    // Flip bits in a stored byte, as a worn or interrupted flash write would
+    void corrupt(const char* key, size_t offset, uint8_t mask = 0x01) {
+        records_[key].at(offset) ^= mask;
+    }
+
+    std::vector<uint8_t>& record(const char* key) { return records_[key]; }
+    void setFailing(bool fail) { fail_ = fail; }
+    unsigned int getWriteCount() const { return write_count_; }
+};
+
 // Reset all fakes
 inline void reset_all_fakes() {
     adc_read_raw_reset();
@@ -135,8 +297,9 @@ inline void reset_all_fakes() {
     gpio_set_low_reset();
     gpio_get_state_reset();
     uart_write_reset();
+    pwm_set_pulse_cycles_reset();
     
     // Reset mock instances
-    extern MockUartDriver mock_uart;
+    extern thread_local MockUartDriver mock_uart;
     mock_uart.clear();
 }
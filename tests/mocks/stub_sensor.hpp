@@ -0,0 +1,17 @@
+#pragma once
+
+/**
+ * @file stub_sensor.hpp
+ * @brief Sensor that reads whatever the test last set
+ *
+ * For tests that drive a controller from a plant model or a scripted
+ * temperature rather than from ADC codes.
+ */
+
+#include "ISensor.hpp"
+
+class StubSensor : public ISensor {
+public:
+    float value = 25.0f;
+    float readValue() override { return value; }
+};
@@ -0,0 +1,46 @@
+#include "ztest_framework.hpp"
+#include "AdaptiveSampler.hpp"
+
+ZTEST(adaptive_sampler, starts_at_initial_period) {
+    AdaptiveSampler sampler;
+    zassert_equal(sampler.getPeriodMs(), 1000u, "Default initial period should be 1 s");
+}
+
+ZTEST(adaptive_sampler, grows_gradually_when_stable) {
+    AdaptiveSampler sampler;
+    uint32_t p1 = sampler.next(25.0f, 0.0f, 1.0f);
+    uint32_t p2 = sampler.next(25.0f, 0.0f, p1 / 1000.0f);
+    zassert_equal(p1, 1500u, "Period should grow by the growth limit");
+    zassert_equal(p2, 2250u, "Period should keep growing");
+
+    for (int i = 0; i < 20; i++) sampler.next(25.0f, 0.0f, 1.0f);
+    zassert_equal(sampler.getPeriodMs(), 5000u, "Period should saturate at the maximum");
+}
+
+ZTEST(adaptive_sampler, shrinks_on_fast_transient) {
+    AdaptiveSampler sampler;
+    for (int i = 0; i < 20; i++) sampler.next(25.0f, 0.0f, 5.0f);
+
+    // 0.2 °C/s with a 0.1 °C target -> 500 ms
+    sampler.next(26.0f, 0.2f, 5.0f);
+    zassert_equal(sampler.getPeriodMs(), 500u, "Period should follow target_delta / rate");
+    zassert_float_equal(sampler.getRate(), 0.2f, "Rate should be estimated from actual dt");
+}
+
+ZTEST(adaptive_sampler, large_error_forces_minimum_period) {
+    AdaptiveSampler sampler;
+    sampler.next(25.0f, 0.0f, 1.0f);
+    uint32_t period = sampler.next(25.0f, -2.0f, 1.0f);
+    zassert_equal(period, 250u, "Large error should use the minimum period");
+}
+
+ZTEST(adaptive_sampler, custom_bounds) {
+    AdaptiveSampler::Config config;
+    config.min_period_ms = 100;
+    config.max_period_ms = 2000;
+    config.growth_limit = 10.0f;
+    AdaptiveSampler sampler(config);
+
+    zassert_equal(sampler.next(25.0f, 0.0f, 1.0f), 2000u, "Period should clamp to custom maximum");
+    zassert_equal(sampler.next(35.0f, 0.0f, 1.0f), 100u, "Period should clamp to custom minimum");
+}
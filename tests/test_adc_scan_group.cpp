@@ -0,0 +1,88 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "AdcScanGroup.hpp"
+#include "NtcThermistor.hpp"
+#include <cmath>
+
+ZTEST(adc_scan_group, scan_delivers_all_channels_in_one_transaction)
+{
+    MockAdcScanDriver driver;
+    const uint8_t channels[] = {0, 3, 5};
+    driver.setValue(0, 310);
+    driver.setValue(3, 400);
+    driver.setValue(5, 500);
+
+    AdcScanGroup group(driver, channels, 3);
+    zassert_true(group.isConfigured(), "Group should configure");
+    zassert_true(group.scan(), "Scan should succeed");
+
+    zassert_equal(driver.getConfigureCount(), 1u, "Sequence configured once");
+    zassert_equal(driver.getScanCount(), 1u, "One transaction for all channels");
+    zassert_equal(group.raw(0), 310, "Channel 0 sample");
+    zassert_equal(group.raw(1), 400, "Channel 3 sample");
+    zassert_equal(group.raw(2), 500, "Channel 5 sample");
+}
+
+ZTEST(adc_scan_group, channel_views_read_latest_scan)
+{
+    MockAdcScanDriver driver;
+    const uint8_t channels[] = {1, 2};
+    driver.setValue(1, 310);
+    driver.setValue(2, 450);
+    AdcScanGroup group(driver, channels, 2);
+    group.scan();
+
+    ISensor& second = group.channel(1);
+    zassert_float_equal(second.readValue(), TemperatureProcessor::toCelsius(450), "View converts its channel");
+    zassert_float_equal(second.readValue(), TemperatureProcessor::toCelsius(450), "Views do not trigger conversions");
+    zassert_equal(driver.getScanCount(), 1u, "Reading views is free");
+
+    driver.setValue(2, 500);
+    group.scan();
+    zassert_float_equal(second.readValue(), TemperatureProcessor::toCelsius(500), "View follows the next scan");
+}
+
+ZTEST(adc_scan_group, channels_convert_with_their_own_sensor_model)
+{
+    MockAdcScanDriver driver;
+    const uint8_t channels[] = {0, 4};
+    driver.setValue(0, 310);
+    driver.setValue(4, 2048);
+    AdcScanGroup group(driver, channels, 2);
+    group.setConversion(1, &Ntc10kTable::toCelsius);
+    group.scan();
+
+    zassert_float_equal(group.channel(0).readValue(), TemperatureProcessor::toCelsius(310), "LM35 by default");
+    zassert_float_equal(group.channel(1).readValue(), Ntc10kTable::toCelsius(2048), "Thermistor through its table");
+    zassert_true(std::fabs(group.channel(1).readValue() - 25.0f) < 0.5f, "Mid-scale divider is about 25 °C");
+
+    group.setConversion(1, nullptr);
+    zassert_float_equal(group.channel(1).readValue(), TemperatureProcessor::toCelsius(2048), "Default restored");
+}
+
+ZTEST(adc_scan_group, failed_scan_keeps_previous_samples)
+{
+    MockAdcScanDriver driver;
+    const uint8_t channels[] = {4};
+    driver.setValue(4, 320);
+    AdcScanGroup group(driver, channels, 1);
+    group.scan();
+
+    driver.setValue(4, 900);
+    driver.setFailing(true);
+    zassert_false(group.scan(), "Driver failure reported");
+    zassert_equal(group.raw(0), 320, "Previous sample retained");
+    zassert_equal(group.getScanCount(), 1u, "Only successful scans counted");
+    zassert_equal(group.getFailedScanCount(), 1u, "Failure counted");
+}
+
+ZTEST(adc_scan_group, rejects_oversized_sequence)
+{
+    MockAdcScanDriver driver;
+    uint8_t channels[AdcScanGroup::kMaxChannels + 1] = {};
+    AdcScanGroup group(driver, channels, AdcScanGroup::kMaxChannels + 1);
+
+    zassert_false(group.isConfigured(), "Too many channels");
+    zassert_false(group.scan(), "Unconfigured group cannot scan");
+    zassert_equal(driver.getScanCount(), 0u, "Driver untouched");
+}
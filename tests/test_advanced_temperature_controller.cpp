@@ -0,0 +1,149 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "mocks/stub_sensor.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+
+ZTEST(advanced_controller, periodic_mode_processes_every_cycle) {
+    reset_all_fakes();
+    StubSensor sensor;
+    VariableFan fan;
+    MockUartDriver uart;
+    UartLogger logger(uart);
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+
+    for (int i = 0; i < 5; i++) controller.regulate();
+
+    zassert_equal(uart_write_fake.call_count, 5, "Every cycle should log");
+    zassert_equal(controller.getStatistics().skipped_cycles, 0u, "No cycles should be skipped");
+    zassert_equal(controller.getPIDState().update_count, 5u, "PID should run every cycle");
+}
+
+ZTEST(advanced_controller, event_mode_skips_flat_readings) {
+    reset_all_fakes();
+    StubSensor sensor;
+    VariableFan fan;
+    MockUartDriver uart;
+    UartLogger logger(uart);
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+
+    AdvancedTemperatureController::EventConfig events;
+    events.enabled = true;
+    events.deadband = 0.5f;
+    events.max_silent_cycles = 100;
+    controller.setEventMode(events);
+
+    sensor.value = 30.0f;
+    controller.regulate();              // first cycle always runs
+    sensor.value = 30.2f;
+    controller.regulate();              // within deadband
+    controller.regulate();
+    sensor.value = 30.6f;
+    controller.regulate();              // moved by 0.6 -> runs
+
+    zassert_equal(uart_write_fake.call_count, 2, "Only changed readings should log");
+    zassert_equal(controller.getStatistics().skipped_cycles, 2u, "Two cycles should be held");
+    zassert_equal(controller.getStatistics().total_cycles, 4u, "All cycles should be counted");
+    zassert_equal(controller.getPIDState().update_count, 2u, "PID should only run twice");
+}
+
+ZTEST(advanced_controller, event_mode_forces_update_after_silence) {
+    reset_all_fakes();
+    StubSensor sensor;
+    VariableFan fan;
+    MockUartDriver uart;
+    UartLogger logger(uart);
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+
+    AdvancedTemperatureController::EventConfig events;
+    events.enabled = true;
+    events.deadband = 1.0f;
+    events.max_silent_cycles = 4;
+    controller.setEventMode(events);
+
+    for (int i = 0; i < 9; i++) controller.regulate();
+
+    // Cycles 1, 5 and 9 are processed
+    zassert_equal(uart_write_fake.call_count, 3, "Silence interval should force processing");
+}
+
+ZTEST(advanced_controller, event_mode_runs_on_setpoint_change_at_flat_reading) {
+    reset_all_fakes();
+    StubSensor sensor;
+    VariableFan fan;
+    MockUartDriver uart;
+    UartLogger logger(uart);
+    PIDController::Config config;
+    config.setpoint = 30.0f;
+    AdvancedTemperatureController controller(sensor, fan, logger, config);
+    controller.setDetailedTrace(false);
+
+    AdvancedTemperatureController::EventConfig events;
+    events.enabled = true;
+    events.deadband = 0.2f;
+    events.max_silent_cycles = 60;
+    controller.setEventMode(events);
+
+    sensor.value = 29.5f;
+    for (int i = 0; i < 5; i++) controller.regulate();
+    zassert_float_equal(fan.getOutput(), 0.0f, "Below the setpoint: fan off");
+    uint32_t updates = controller.getPIDState().update_count;
+
+    controller.setSetpoint(20.0f);
+    controller.regulate();
+    zassert_equal(controller.getPIDState().update_count, updates + 1, "New setpoint processed at once");
+    zassert_true(fan.getOutput() > 0.0f, "Fan reacts to the lower setpoint");
+
+    // Settled on the new setpoint: flat readings are held again
+    controller.regulate();
+    zassert_equal(controller.getPIDState().update_count, updates + 1, "Held once the setpoint is applied");
+
+    // A ramping trajectory moves the PID setpoint every cycle
+    SetpointTrajectory::Config ramp;
+    ramp.profile = SetpointTrajectory::Profile::Ramp;
+    SetpointTrajectory trajectory(ramp);
+    controller.setTrajectory(&trajectory);
+    controller.setSetpoint(25.0f);
+    updates = controller.getPIDState().update_count;
+    for (int i = 0; i < 10; i++) controller.regulate();
+    zassert_equal(controller.getPIDState().update_count, updates + 10, "Every ramp step processed");
+}
+
+ZTEST(advanced_controller, event_mode_integral_matches_periodic) {
+    reset_all_fakes();
+    StubSensor sensor_a;
+    StubSensor sensor_b;
+    VariableFan fan_a;
+    VariableFan fan_b;
+    MockUartDriver uart;
+    UartLogger logger(uart);
+
+    PIDController::Config config;
+    config.integral_max = 1000.0f;
+    AdvancedTemperatureController periodic(sensor_a, fan_a, logger, config);
+    AdvancedTemperatureController event(sensor_b, fan_b, logger, config);
+    periodic.setDetailedTrace(false);
+    event.setDetailedTrace(false);
+
+    AdvancedTemperatureController::EventConfig events;
+    events.enabled = true;
+    events.deadband = 0.5f;
+    event.setEventMode(events);
+
+    const float trace[] = {27.0f, 27.1f, 27.2f, 27.3f, 27.4f, 28.0f};
+    for (float t : trace) {
+        sensor_a.value = t;
+        sensor_b.value = t;
+        periodic.regulate();
+        event.regulate();
+    }
+
+    zassert_float_equal(event.getPIDState().integral, periodic.getPIDState().integral,
+                        "Held cycles should not lose integral");
+    zassert_float_equal(event.getPIDState().i_term, periodic.getPIDState().i_term,
+                        "Integral term should agree once the event cycle runs");
+}
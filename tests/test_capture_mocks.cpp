@@ -0,0 +1,88 @@
+#include "ztest_framework.hpp"
+#include "mocks/capture_mocks.hpp"
+#include "AdcSensor.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include <cstdio>
+
+ZTEST(capture_mocks, ring_keeps_most_recent_values)
+{
+    CaptureRing<int> ring(4);
+    for (int i = 0; i < 10; i++) {
+        ring.push(i);
+    }
+
+    zassert_equal(ring.size(), 4u, "Ring holds capacity values");
+    zassert_equal(ring.total(), 10u, "Total counts every push");
+    zassert_equal(ring.overwritten(), 6u, "Older values are overwritten");
+    zassert_equal(ring.recent(0), 9, "Most recent value");
+    zassert_equal(ring.recent(3), 6, "Oldest retained value");
+}
+
+ZTEST(capture_mocks, uart_ring_counts_beyond_capacity)
+{
+    RingUartDriver uart(2);
+    UartLogger logger(uart);
+
+    logger.log(21.0f);
+    logger.log(22.0f);
+    logger.log(23.5f);
+
+    zassert_equal(uart.getMessageCount(), 3u, "All messages counted");
+    zassert_str_equal(uart.recent(0), "Temp=23.50°C\n", "Latest message retained");
+    zassert_str_equal(uart.recent(1), "Temp=22.00°C\n", "Previous message retained");
+    zassert_str_equal(uart.recent(2), "", "Overwritten message is gone");
+    zassert_true(uart.getByteCount() > 3 * 10, "Bytes counted for every message");
+}
+
+ZTEST(capture_mocks, adc_streams_from_file)
+{
+    char path[] = "/tmp/adc_trace_XXXXXX";
+    int fd = mkstemp(path);
+    zassert_true(fd >= 0, "Temp file created");
+    FILE* out = fdopen(fd, "w");
+    fprintf(out, "800\n1000\n1200\n");
+    fclose(out);
+
+    StreamAdcDriver adc = StreamAdcDriver::fromFile(path);
+    remove(path);
+
+    zassert_equal(adc.readRaw(), 800, "First recorded value");
+    zassert_equal(adc.readRaw(), 1000, "Second recorded value");
+    zassert_equal(adc.readRaw(), 1200, "Third recorded value");
+    zassert_equal(adc.readRaw(), 800, "Recording loops");
+    zassert_equal(adc.getReadCount(), 4u, "Reads counted");
+}
+
+ZTEST(capture_mocks, million_cycle_soak)
+{
+    // Slow triangle swing across the 25 °C setpoint: raw 300-331 (24.2-26.7 °C)
+    StreamAdcDriver adc([](uint64_t i) -> uint16_t {
+        uint64_t phase = (i / 16) % 64;
+        return static_cast<uint16_t>(300 + (phase < 32 ? phase : 63 - phase));
+    });
+    RingPwmDriver pwm(1000, 256);
+    RingUartDriver uart(256);
+    AdcSensor sensor(adc);
+    VariableFan fan(pwm);
+    UartLogger logger(uart);
+
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+    controller.setSnapshotPublishing(false);   // No monitor thread in this test
+
+    // Time per cycle is the benchmarks' "regulate" entry; this checks behaviour only
+    const uint32_t cycles = 1000000;
+    for (uint32_t i = 0; i < cycles; i++) {
+        controller.regulate();
+    }
+
+    zassert_equal(adc.getReadCount(), cycles, "One sensor read per cycle");
+    zassert_equal(uart.getMessageCount(), cycles, "One log line per cycle");
+    zassert_equal(controller.getStatistics().total_cycles, cycles, "Every cycle counted");
+    zassert_true(pwm.getWriteCount() > 0, "Fan was driven");
+    zassert_true(pwm.getWriteCount() + fan.getPwmStats().writes_suppressed == cycles,
+                 "Every setOutput either wrote or was suppressed");
+    zassert_true(pwm.getMaxPulse() > pwm.getMinPulse(), "Fan output varied with temperature");
+}
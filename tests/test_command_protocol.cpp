@@ -0,0 +1,193 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "CommandProtocol.hpp"
+#include "AdcSensor.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include <vector>
+
+#define UartDriver MockUartDriver
+
+namespace {
+
+std::vector<uint8_t> frame(uint8_t command, uint8_t sequence, const std::vector<uint8_t>& payload) {
+    std::vector<uint8_t> bytes = {protocol::kStartOfFrame, static_cast<uint8_t>(payload.size()), command, sequence};
+    bytes.insert(bytes.end(), payload.begin(), payload.end());
+    uint16_t crc = crc::crc16(bytes.data() + 1, bytes.size() - 1);
+    bytes.push_back(static_cast<uint8_t>(crc));
+    bytes.push_back(static_cast<uint8_t>(crc >> 8));
+    return bytes;
+}
+
+std::vector<uint8_t> floats(std::initializer_list<float> values) {
+    std::vector<uint8_t> bytes;
+    for (float value : values) {
+        uint8_t raw[4];
+        memcpy(raw, &value, sizeof(raw));
+        bytes.insert(bytes.end(), raw, raw + 4);
+    }
+    return bytes;
+}
+
+void send(ByteRing& ring, const std::vector<uint8_t>& bytes) {
+    ring.push(bytes.data(), bytes.size());
+}
+
+// Poll until nothing more can be done in this instant
+void drain(CommandServer& server, uint32_t now_ms = 0) {
+    for (int i = 0; i < 1000; i++) {
+        CommandServer::PollResult result = server.poll(now_ms);
+        if (result == CommandServer::PollResult::Idle || result == CommandServer::PollResult::Incomplete) return;
+    }
+}
+
+struct Rig {
+    MockAdcDriver adc;
+    MockPwmDriver pwm;
+    MockUartDriver log_uart;
+    MockUartDriver uart;
+    AdcSensor sensor{adc};
+    VariableFan fan{pwm};
+    UartLogger logger{log_uart};
+    AdvancedTemperatureController controller{sensor, fan, logger};
+    StaticByteRing<256> rx;
+    CommandServer server{rx, uart, controller};
+
+    Rig() {
+        reset_all_fakes();
+        controller.setDetailedTrace(false);
+    }
+};
+
+} // namespace
+
+ZTEST(command_protocol, set_setpoint_round_trip)
+{
+    Rig rig;
+    send(rig.rx, frame(protocol::SetSetpoint, 7, floats({31.0f})));
+    drain(rig.server);
+
+    zassert_true(rig.uart.getBytes() == frame(protocol::SetSetpoint | protocol::kReplyFlag, 7, {protocol::Ok}),
+                 "Ok reply echoes the sequence number");
+    adc_read_raw_fake.return_val = 372;
+    rig.controller.regulate();
+    zassert_float_equal(rig.controller.getSetpoint(), 31.0f, "Setpoint applied on the next cycle");
+
+    rig.uart.clear();
+    send(rig.rx, frame(protocol::SetSetpoint, 8, floats({500.0f})));
+    drain(rig.server);
+    zassert_true(rig.uart.getBytes() == frame(protocol::SetSetpoint | protocol::kReplyFlag, 8, {protocol::BadValue}),
+                 "Out-of-range setpoint refused");
+
+    rig.uart.clear();
+    send(rig.rx, frame(protocol::SetGains, 9, floats({4.0f, 0.2f})));
+    drain(rig.server);
+    zassert_true(rig.uart.getBytes() == frame(protocol::SetGains | protocol::kReplyFlag, 9, {protocol::BadLength}),
+                 "Short payload refused");
+
+    rig.uart.clear();
+    send(rig.rx, frame(0x55, 10, {}));
+    drain(rig.server);
+    zassert_true(rig.uart.getBytes() == frame(0x55 | protocol::kReplyFlag, 10, {protocol::UnknownCommand}),
+                 "Unknown command answered");
+    zassert_equal(rig.server.getStats().frames, 4u, "All four frames dispatched");
+}
+
+ZTEST(command_protocol, read_history_oldest_first)
+{
+    Rig rig;
+    for (int i = 0; i < 40; i++) {
+        rig.server.recordSample(20.0f + i * 0.25f);
+    }
+    send(rig.rx, frame(protocol::ReadHistory, 1, {3}));
+    drain(rig.server);
+
+    // Last three of 40 samples: 29.25, 29.50, 29.75 °C
+    std::vector<uint8_t> expected = {protocol::Ok, 3, 0x6D, 0x0B, 0x86, 0x0B, 0x9F, 0x0B};
+    zassert_true(rig.uart.getBytes() == frame(protocol::ReadHistory | protocol::kReplyFlag, 1, expected),
+                 "Newest samples in centi-degrees, oldest first");
+}
+
+ZTEST(command_protocol, resyncs_after_garbage_and_bad_crc)
+{
+    Rig rig;
+    std::vector<uint8_t> corrupt = frame(protocol::SetSetpoint, 1, floats({25.0f}));
+    corrupt[5] ^= 0x40;
+    send(rig.rx, {0x00, 0xA5, 0xFF, 0x13});    // Noise, including a SOF with an impossible length
+    send(rig.rx, corrupt);
+    send(rig.rx, frame(protocol::SetSetpoint, 2, floats({26.0f})));
+    drain(rig.server);
+
+    const CommandServer::Stats& stats = rig.server.getStats();
+    zassert_equal(stats.frames, 1u, "Only the good frame dispatched");
+    zassert_equal(stats.crc_errors, 1u, "Corrupt frame rejected by CRC");
+    zassert_equal(stats.length_errors, 1u, "Oversized length rejected");
+    zassert_true(rig.uart.getBytes() == frame(protocol::SetSetpoint | protocol::kReplyFlag, 2, {protocol::Ok}),
+                 "Good frame after the noise answered");
+    zassert_equal(rig.rx.available(), 0u, "Everything consumed");
+}
+
+ZTEST(command_protocol, frames_parse_across_ring_wraparound)
+{
+    Rig rig;
+    std::vector<uint8_t> request = frame(protocol::SetGains, 0, floats({5.0f, 0.25f, 1.5f}));
+    // Step the frame start through every offset so header, payload and CRC all straddle the end
+    for (int i = 0; i < 256; i++) {
+        rig.rx.push(0x00);
+        drain(rig.server);
+        request[3] = static_cast<uint8_t>(i);
+        uint16_t crc = crc::crc16(request.data() + 1, request.size() - 3);
+        request[request.size() - 2] = static_cast<uint8_t>(crc);
+        request[request.size() - 1] = static_cast<uint8_t>(crc >> 8);
+        send(rig.rx, request);
+        drain(rig.server);
+    }
+    zassert_equal(rig.server.getStats().frames, 256u, "Every offset parsed");
+    zassert_equal(rig.server.getStats().crc_errors, 0u, "No in-place CRC mistakes");
+    adc_read_raw_fake.return_val = 372;
+    rig.controller.regulate();
+    zassert_float_equal(rig.controller.getActiveConfig().kd, 1.5f, "Gains applied");
+}
+
+ZTEST(command_protocol, partial_frame_times_out)
+{
+    Rig rig;
+    std::vector<uint8_t> request = frame(protocol::ReadStats, 3, {});
+    send(rig.rx, std::vector<uint8_t>(request.begin(), request.begin() + 3));
+    zassert_true(rig.server.poll(0) == CommandServer::PollResult::Incomplete, "Waits for the rest");
+    zassert_true(rig.server.poll(CommandServer::kFrameTimeoutMs) == CommandServer::PollResult::Incomplete,
+                 "Still within the timeout");
+    drain(rig.server, CommandServer::kFrameTimeoutMs + 1);
+    zassert_true(rig.server.getStats().timeouts >= 1u, "Stale partial frame dropped");
+
+    send(rig.rx, request);
+    drain(rig.server, 100);
+    zassert_equal(rig.server.getStats().frames, 1u, "Next frame parsed normally");
+    zassert_equal(rig.uart.getBytes().size(), protocol::kHeaderSize + 1 + 32 + protocol::kCrcSize,
+                  "Stats reply: status plus 32 bytes");
+}
+
+ZTEST(command_protocol, poll_work_is_bounded)
+{
+    Rig rig;
+    // Worst case for a resync scan: SOFs that claim a full frame and fail the CRC
+    std::vector<uint8_t> flood(protocol::kMaxFrame, protocol::kStartOfFrame);
+    for (size_t i = 1; i < flood.size(); i += 2) flood[i] = protocol::kMaxPayload;
+    for (int round = 0; round < 3; round++) {
+        send(rig.rx, flood);
+    }
+    send(rig.rx, frame(protocol::ReadStats, 1, {}));
+
+    // False SOFs near the end claim bytes that never come: only the timeout clears them
+    int polls = 0;
+    uint32_t now_ms = 0;
+    while (rig.server.poll(now_ms) != CommandServer::PollResult::Idle && polls < 10000) {
+        polls++;
+        now_ms += 10;
+    }
+    zassert_true(rig.server.getStats().max_examined <= CommandServer::kScanBudget,
+                 "No poll examines more than the budget");
+    zassert_true(polls > 1, "Flood spread over several polls");
+    zassert_equal(rig.server.getStats().frames, 1u, "Trailing frame still found");
+}
@@ -0,0 +1,134 @@
+#include "ztest_framework.hpp"
+#include "CoopScheduler.hpp"
+#include <vector>
+
+// Built only with -DTEMPCTRL_COROUTINES=ON (C++20)
+
+namespace {
+
+CoopTask periodic(CoopScheduler& sched, uint64_t period_us, int count, std::vector<uint64_t>& wakeups) {
+    uint64_t next = sched.now();
+    for (int i = 0; i < count; i++) {
+        next += period_us;
+        co_await sched.sleepUntil(next);
+        wakeups.push_back(sched.now());
+    }
+}
+
+CoopTask waitTwice(CoopScheduler&, CoopEvent& event, int id, std::vector<int>& order) {
+    co_await event.wait();
+    order.push_back(id);
+    co_await event.wait();
+    order.push_back(id + 10);
+}
+
+CoopTask sleeper(CoopScheduler& sched, uint64_t delay_us, int id, std::vector<int>& order) {
+    co_await sched.sleepFor(delay_us);
+    order.push_back(id);
+}
+
+CoopTask forever(CoopScheduler& sched) {
+    for (;;) {
+        co_await sched.sleepFor(1000);
+    }
+}
+
+} // namespace
+
+ZTEST(coop_scheduler, periodic_wakeups_fire_at_exact_deadlines)
+{
+    StaticFramePool<512, 4> pool;
+    CoopScheduler sched(pool);
+    std::vector<uint64_t> fast;
+    std::vector<uint64_t> slow;
+    zassert_true(sched.spawn(periodic(sched, 250, 8, fast)), "Spawned");
+    zassert_true(sched.spawn(periodic(sched, 1000, 2, slow)), "Spawned");
+
+    // Uneven steps must not shift the deadlines
+    sched.advanceTo(333);
+    sched.advanceTo(1700);
+    sched.advanceTo(2000);
+
+    zassert_equal(fast.size(), 8u, "Every period fired");
+    for (size_t i = 0; i < fast.size(); i++) {
+        zassert_equal(fast[i], 250u * (i + 1), "Woken at its own deadline");
+    }
+    zassert_equal(slow.size(), 2u, "Slow task fired twice");
+    zassert_equal(slow[1], 2000u, "No drift");
+    zassert_equal(pool.inUse(), 0u, "Finished tasks returned their frames");
+    zassert_equal(sched.getStats().live_tasks, 0u, "No live tasks");
+}
+
+ZTEST(coop_scheduler, timers_fire_in_deadline_order)
+{
+    StaticFramePool<512, 8> pool;
+    CoopScheduler sched(pool);
+    std::vector<int> order;
+    // Inserted at the tail, head, middle near each end, and a tie
+    const uint64_t delays[] = {500, 100, 900, 200, 800, 500};
+    for (int i = 0; i < 6; i++) {
+        sched.spawn(sleeper(sched, delays[i], i, order));
+    }
+    sched.runReady();
+    zassert_equal(sched.nextDeadline(), 100u, "Earliest deadline first in line");
+
+    sched.advanceTo(1000);
+    const int expected[] = {1, 3, 0, 5, 4, 2};
+    zassert_equal(order.size(), 6u, "All fired");
+    for (int i = 0; i < 6; i++) {
+        zassert_equal(order[i], expected[i], "Deadline order, ties first-come first-served");
+    }
+    zassert_equal(sched.nextDeadline(), UINT64_MAX, "No timers left");
+}
+
+ZTEST(coop_scheduler, event_wakes_waiters_in_order_and_latches)
+{
+    StaticFramePool<512, 4> pool;
+    CoopScheduler sched(pool);
+    CoopEvent event(sched);
+    std::vector<int> order;
+    sched.spawn(waitTwice(sched, event, 1, order));
+    sched.spawn(waitTwice(sched, event, 2, order));
+    sched.runReady();
+    zassert_true(order.empty(), "Both waiting");
+
+    event.signal();
+    sched.runReady();
+    zassert_equal(order.size(), 1u, "One signal wakes one waiter");
+    zassert_equal(order[0], 1, "Longest waiter first");
+
+    event.signal();
+    event.signal();
+    event.signal();     // Nobody waiting for this one: latched
+    sched.runReady();
+    // Task 2 then task 1 were woken; task 2 runs first and finds the latch
+    zassert_equal(order.size(), 4u, "Latched signal satisfied the last wait at once");
+    zassert_equal(order[1], 2, "Second waiter");
+    zassert_equal(order[2], 12, "Second task consumed the latched signal");
+    zassert_equal(order[3], 11, "First task's second wait");
+}
+
+ZTEST(coop_scheduler, exhausted_pool_rejects_task)
+{
+    StaticFramePool<512, 2> pool;
+    CoopScheduler sched(pool);
+    zassert_true(sched.spawn(forever(sched)), "First fits");
+    zassert_true(sched.spawn(forever(sched)), "Second fits");
+    zassert_false(sched.spawn(forever(sched)), "Pool exhausted");
+    zassert_equal(pool.failedAllocations(), 1u, "Failure counted");
+    zassert_true(pool.largestRequest() <= pool.blockSize(), "Frames fit the blocks");
+}
+
+ZTEST(coop_scheduler, destructor_returns_frames_of_suspended_tasks)
+{
+    StaticFramePool<512, 4> pool;
+    {
+        CoopScheduler sched(pool);
+        sched.spawn(forever(sched));
+        sched.spawn(forever(sched));
+        sched.advanceTo(10000);
+        zassert_equal(pool.inUse(), 2u, "Both endless tasks hold frames");
+        zassert_equal(sched.getStats().resumes, 22u, "Start plus ten wakeups each");
+    }
+    zassert_equal(pool.inUse(), 0u, "Scheduler destroyed its tasks");
+}
@@ -0,0 +1,58 @@
+#include "ztest_framework.hpp"
+#include "CycleProfiler.hpp"
+
+ZTEST(cycle_profiler, histogram_buckets_are_log_linear) {
+    zassert_equal(LatencyHistogram::bucketFor(0), 0u, "0 has its own bucket");
+    zassert_equal(LatencyHistogram::bucketFor(3), 3u, "Small values are linear");
+    zassert_equal(LatencyHistogram::bucketFor(4), 4u, "4 starts the first log bucket");
+    zassert_equal(LatencyHistogram::bucketFor(1000), LatencyHistogram::bucketFor(1023),
+                  "1000 and 1023 share a 25%-wide bucket");
+    zassert_true(LatencyHistogram::bucketFor(0xFFFFFFFFu) < LatencyHistogram::kBuckets,
+                 "Largest value must fit in the table");
+
+    for (unsigned b = 0; b < LatencyHistogram::kBuckets; b++) {
+        uint32_t low = LatencyHistogram::bucketLowerBound(b);
+        zassert_equal(LatencyHistogram::bucketFor(low), b, "Lower bound should map to its own bucket");
+    }
+}
+
+ZTEST(cycle_profiler, histogram_percentiles_and_max) {
+    LatencyHistogram h;
+    for (uint32_t i = 0; i < 99; i++) h.record(100);
+    h.record(5000);
+
+    zassert_equal(h.count(), 100u, "All samples counted");
+    zassert_equal(h.max(), 5000u, "Worst case tracked exactly");
+    zassert_true(h.percentile(50.0f) <= 100 && h.percentile(50.0f) > 75, "p50 should be in the 100 bucket");
+    zassert_true(h.percentile(100.0f) >= 4096, "p100 should reach the outlier bucket");
+}
+
+ZTEST(cycle_profiler, sample_interval_skips_cycles) {
+    CycleProfiler profiler;
+    profiler.setSampleInterval(4);
+    for (int i = 0; i < 12; i++) {
+        profiler.begin();
+        profiler.mark(CycleProfiler::Sensor);
+        profiler.end();
+    }
+    zassert_equal(profiler.histogram(CycleProfiler::Sensor).count(), 3u, "One in four cycles timed");
+    zassert_equal(profiler.histogram(CycleProfiler::Total).count(), 3u, "Totals follow the sampling");
+}
+
+ZTEST(cycle_profiler, format_lists_every_phase) {
+    CycleProfiler profiler;
+    profiler.setSampleInterval(1);
+    profiler.begin();
+    profiler.mark(CycleProfiler::Sensor);
+    profiler.end();
+
+    char buf[512];
+    size_t n = profiler.format(buf, sizeof(buf));
+    zassert_true(n > 0, "Summary should not be empty");
+    zassert_true(std::string(buf).find("sensor   n=1") != std::string::npos, "Sensor line present");
+    zassert_true(std::string(buf).find("total") != std::string::npos, "Total line present");
+
+    char small[16];
+    n = profiler.format(small, sizeof(small));
+    zassert_true(n < sizeof(small), "Truncated output must stay within the buffer");
+}
@@ -0,0 +1,80 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "FanBank.hpp"
+#include <cmath>
+
+namespace {
+
+struct Bank {
+    VariableFan fans[4];
+    VariableFan* pointers[4] = {&fans[0], &fans[1], &fans[2], &fans[3]};
+};
+
+} // namespace
+
+ZTEST(fan_bank, shares_high_airflow_equally)
+{
+    Bank b;
+    FanBank bank(b.pointers, 4);
+    bank.setOutput(80.0f);
+    zassert_equal(bank.runningFans(), 4u, "All fans needed");
+    for (const VariableFan& fan : b.fans) {
+        zassert_true(std::fabs(fan.getAirflow() - 80.0f) < 1.0f, "Each fan carries an equal share");
+    }
+    zassert_true(std::fabs(bank.getAirflow() - 80.0f) < 1.0f, "Bank delivers the request");
+    zassert_float_equal(bank.getOutput(), 80.0f, "Output is the requested airflow");
+}
+
+ZTEST(fan_bank, low_airflow_runs_fewer_fans_above_dead_zone)
+{
+    Bank b;
+    FanBank bank(b.pointers, 4);
+    bank.setOutput(5.0f);
+    zassert_equal(bank.runningFans(), 1u, "One fan is cheapest");
+    zassert_true(b.fans[0].getOutput() > VariableFan::Curve::dead_zone, "Running fan above the dead zone");
+    for (size_t i = 1; i < 4; i++) zassert_false(b.fans[i].isActive(), "Others stopped");
+    zassert_true(std::fabs(bank.getAirflow() - 5.0f) < 0.5f, "Bank delivers the request");
+
+    bank.setOutput(0.0f);
+    zassert_false(bank.isActive(), "All stopped at zero");
+    zassert_equal(bank.runningFans(), 0u, "No fans running");
+}
+
+ZTEST(fan_bank, least_power_never_worse_than_naive_staging)
+{
+    for (float airflow = 1.0f; airflow <= 100.0f; airflow += 1.0f) {
+        float watts[3];
+        const FanBank::Staging strategies[] = {FanBank::Staging::Optimal, FanBank::Staging::Equal,
+                                               FanBank::Staging::Sequential};
+        for (int s = 0; s < 3; s++) {
+            Bank b;
+            FanBank::Config config;
+            config.staging = strategies[s];
+            FanBank bank(b.pointers, 4, config);
+            bank.setOutput(airflow);
+            zassert_true(std::fabs(bank.getAirflow() - airflow) < 1.0f, "Every strategy delivers the request");
+            watts[s] = bank.estimatedPower();
+        }
+        zassert_true(watts[0] <= watts[1] + 0.01f, "No worse than equal staging");
+        zassert_true(watts[0] <= watts[2] + 0.01f, "No worse than sequential staging");
+    }
+}
+
+ZTEST(fan_bank, stages_with_hysteresis)
+{
+    Bank b;
+    FanBank bank(b.pointers, 4);
+    float up = bank.stageUpAt(1);
+    zassert_true(up > 0.0f && up <= 25.0f, "Second fan starts before the first runs out");
+    for (size_t n = 1; n < 4; n++) zassert_true(bank.stageUpAt(n) >= bank.stageUpAt(n - 1), "Table ascending");
+
+    bank.setOutput(up - 0.5f);
+    zassert_equal(bank.runningFans(), 1u, "Below the threshold: one fan");
+    bank.setOutput(up + 0.5f);
+    zassert_equal(bank.runningFans(), 2u, "Above it: two");
+    bank.setOutput(up - 1.0f);
+    zassert_equal(bank.runningFans(), 2u, "Within the hysteresis: still two");
+    bank.setOutput(up - bank.getConfig().hysteresis - 0.5f);
+    zassert_equal(bank.runningFans(), 1u, "Below the hysteresis band: back to one");
+    zassert_equal(bank.getStageChanges(), 3u, "Start, second fan, stop second fan");
+}
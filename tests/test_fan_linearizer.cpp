@@ -0,0 +1,63 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "FanLinearizer.hpp"
+#include "LinearizedActuator.hpp"
+#include "VariableFan.hpp"
+#include <cmath>
+
+ZTEST(fan_linearizer, table_is_built_at_compile_time) {
+    using Linearizer = FanLinearizer<QuadraticFanCurve>;
+    static_assert(Linearizer::table.duty[0] > 4.9f && Linearizer::table.duty[0] <= 5.0f,
+                  "zero airflow entry should sit at the dead-zone edge");
+    static_assert(Linearizer::table.duty[64] == 100.0f, "full airflow needs full duty");
+    zassert_true(Linearizer::table.duty[32] > Linearizer::table.duty[16], "Table should be monotonic");
+}
+
+ZTEST(fan_linearizer, inverse_round_trips_through_curve) {
+    using Linearizer = FanLinearizer<QuadraticFanCurve>;
+    for (int airflow = 5; airflow <= 100; airflow += 5) {
+        float duty = Linearizer::dutyFor(static_cast<float>(airflow));
+        float achieved = QuadraticFanCurve::airflow(duty);
+        zassert_true(std::abs(achieved - airflow) < 0.5f, "Airflow should match request within 0.5%");
+    }
+}
+
+ZTEST(fan_linearizer, zero_request_turns_fan_off) {
+    zassert_equal(FanLinearizer<QuadraticFanCurve>::dutyFor(0.0f), 0.0f, "No airflow means 0% duty");
+    zassert_true(FanLinearizer<QuadraticFanCurve>::dutyFor(0.5f) >= QuadraticFanCurve::dead_zone,
+                 "Any airflow should start above the dead zone");
+}
+
+ZTEST(fan_linearizer, per_model_tables) {
+    float quadratic = FanLinearizer<QuadraticFanCurve>::dutyFor(25.0f);
+    float high_start = FanLinearizer<HighStartFanCurve>::dutyFor(25.0f);
+    zassert_float_equal(quadratic, 52.5f, "Quadratic fan needs 52.5% duty for 25% airflow");
+    zassert_true(std::abs(HighStartFanCurve::airflow(high_start) - 25.0f) < 0.5f,
+                 "High-start fan table should invert its own curve");
+}
+
+ZTEST(fan_linearizer, actuator_forwards_duty_to_fan) {
+    reset_all_fakes();
+    VariableFan fan;
+    LinearizedActuator<VariableFan::Curve> actuator(fan);
+
+    actuator.setOutput(25.0f);
+    zassert_equal(actuator.getOutput(), 25.0f, "Decorator should report requested airflow");
+    zassert_float_equal(fan.getOutput(), 52.5f, "Fan should receive the inverse-mapped duty");
+    zassert_float_equal(fan.getAirflow(), 25.0f, "Fan airflow should match the request");
+
+    actuator.deactivate();
+    zassert_false(actuator.isActive(), "Deactivate should stop the fan");
+}
+
+ZTEST(fan_linearizer, fan_reports_airflow_with_its_own_curve) {
+    reset_all_fakes();
+    BasicVariableFan<HighStartFanCurve> fan;
+    LinearizedActuator<HighStartFanCurve> actuator(fan);
+    IVariableActuator& output = actuator;
+
+    output.setOutput(40.0f);
+    zassert_true(fan.getOutput() > HighStartFanCurve::dead_zone, "Duty above the high start threshold");
+    zassert_true(std::fabs(output.getAirflow() - 40.0f) < 0.5f, "Reported airflow matches the request");
+    zassert_float_equal(fan.getAirflow(), HighStartFanCurve::airflow(fan.getOutput()), "Fan uses its own curve");
+}
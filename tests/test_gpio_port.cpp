@@ -0,0 +1,100 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "GpioPort.hpp"
+#include "GpioFan.hpp"
+#include <vector>
+
+namespace {
+
+const int kFans = 32;
+
+// Which fans run in each of four cycles; the last repeats the third
+const uint32_t kPatterns[] = {0x0000FFFFu, 0x0F0F0F0Fu, 0xFFFFFFFFu, 0xFFFFFFFFu};
+
+void drive(std::vector<GpioFan>& fans, uint32_t pattern) {
+    for (int i = 0; i < kFans; i++) {
+        if (pattern & (1u << i)) {
+            fans[i].activate();
+        } else {
+            fans[i].deactivate();
+        }
+    }
+}
+
+} // namespace
+
+ZTEST(gpio_port, commit_writes_changed_pins_as_masks)
+{
+    MockGpioPortDriver driver;
+    GpioPort port(driver);
+    port.set(0x5u);
+    zassert_equal(driver.getWriteCount(), 0u, "Nothing written before commit");
+    zassert_equal(port.pending(), 0x5u, "Two pins pending");
+
+    zassert_true(port.commit(), "Changed pins written");
+    zassert_equal(driver.getLastSet(), 0x5u, "Set mask");
+    zassert_equal(driver.getLastClear(), 0u, "Nothing to clear");
+
+    port.clear(0x1u);
+    port.set(0x8u);
+    port.commit();
+    zassert_equal(driver.getLastSet(), 0x8u, "Only the newly set pin");
+    zassert_equal(driver.getLastClear(), 0x1u, "Only the newly cleared pin");
+    zassert_equal(driver.getState(), 0xCu, "Port matches the shadow");
+    zassert_equal(driver.getWriteCount(), 2u, "One write per commit");
+}
+
+ZTEST(gpio_port, unchanged_commit_skips_the_write)
+{
+    MockGpioPortDriver driver;
+    GpioPort port(driver);
+    port.set(0x3u);
+    port.commit();
+    port.clear(0x1u);
+    port.set(0x1u);   // Back where it was
+    zassert_false(port.commit(), "Net change is nothing");
+    zassert_equal(driver.getWriteCount(), 1u, "No second write");
+    zassert_equal(port.getStats().writes_issued, 1u, "Issued counted");
+    zassert_equal(port.getStats().writes_suppressed, 1u, "Suppressed counted");
+}
+
+ZTEST(gpio_port, fan_sets_its_bit)
+{
+    MockGpioPortDriver driver;
+    GpioPort port(driver);
+    GpioFan fan(port, 7);
+    IActuator& actuator = fan;
+    actuator.activate();
+    zassert_true(port.isSet(1u << 7), "Shadow bit set");
+    zassert_equal(driver.getState(), 0u, "Pin unchanged until commit");
+    port.commit();
+    zassert_equal(driver.getState(), 1u << 7, "Pin high after commit");
+    actuator.deactivate();
+    port.commit();
+    zassert_equal(driver.getState(), 0u, "Pin low again");
+}
+
+ZTEST(gpio_port, bus_writes_per_cycle_for_32_fans)
+{
+    // Before: one driver call (and register write) per fan per cycle
+    reset_all_fakes();
+    MockGpioDriver pins[kFans];
+    std::vector<GpioFan> per_pin;
+    for (int i = 0; i < kFans; i++) per_pin.emplace_back(pins[i]);
+    for (uint32_t pattern : kPatterns) drive(per_pin, pattern);
+    unsigned int per_pin_writes = gpio_set_high_fake.call_count + gpio_set_low_fake.call_count;
+    zassert_equal(per_pin_writes, 4u * kFans, "32 writes every cycle");
+
+    // After: at most one port write per cycle, none when nothing changed
+    MockGpioPortDriver driver;
+    GpioPort port(driver);
+    std::vector<GpioFan> batched;
+    for (int i = 0; i < kFans; i++) batched.emplace_back(port, static_cast<uint8_t>(i));
+    for (uint32_t pattern : kPatterns) {
+        drive(batched, pattern);
+        port.commit();
+        zassert_equal(driver.getState(), pattern, "Port matches the fans");
+    }
+    zassert_equal(driver.getWriteCount(), 3u, "One write per changed cycle");
+    zassert_equal(port.getStats().writes_suppressed, 1u, "Repeated cycle skipped");
+}
@@ -1,4 +1,12 @@
 #include "ztest_framework.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <mutex>
+#include <thread>
 
 // Global test case storage
 std::vector<TestCase> test_cases;
@@ -13,33 +21,195 @@ extern "C" {
     void tearDown();
 }
 
-int main() {
-    std::cout << "Running embedded HAL unit tests...\n" << std::endl;
-    
+namespace {
+
+struct RunnerOptions {
+    unsigned jobs = 0;              // 0 = one worker per hardware thread
+    std::string filter;             // Substring of "suite::name"
+    unsigned shard_index = 0;
+    unsigned shard_count = 1;
+    unsigned repeat = 1;            // Iterations (0 = until failure); stops at the first failing one
+    unsigned slowest = 10;          // Slowest tests to report
+    bool list = false;
+};
+
+struct TestResult {
+    const TestCase* test = nullptr;
+    bool passed = false;
+    std::string message;
+    double ms = 0.0;
+};
+
+void usage(const char* prog) {
+    std::cout << "usage: " << prog << " [options]\n"
+              << "  -j, --jobs N        worker threads (default: hardware threads)\n"
+              << "  --filter TEXT       run tests whose suite::name contains TEXT\n"
+              << "  --shard I/N         run shard I (0-based) of N, for splitting across processes\n"
+              << "  --repeat N          run up to N iterations, stopping at the first failure (0 = forever)\n"
+              << "  --slowest N         report the N slowest tests (0 = all)\n"
+              << "  --list              list selected tests and exit\n"
+              << "Sharding can also come from TEST_SHARD_INDEX / TEST_TOTAL_SHARDS.\n";
+}
+
+bool parseArgs(int argc, char** argv, RunnerOptions& options) {
+    if (const char* index = std::getenv("TEST_SHARD_INDEX")) {
+        options.shard_index = static_cast<unsigned>(std::atoi(index));
+    }
+    if (const char* total = std::getenv("TEST_TOTAL_SHARDS")) {
+        options.shard_count = static_cast<unsigned>(std::max(1, std::atoi(total)));
+    }
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--list") {
+            options.list = true;
+            continue;
+        }
+        if (i + 1 >= argc) return false;
+        const char* value = argv[++i];
+        if (arg == "-j" || arg == "--jobs") {
+            options.jobs = static_cast<unsigned>(std::atoi(value));
+        } else if (arg == "--filter") {
+            options.filter = value;
+        } else if (arg == "--shard") {
+            unsigned index = 0, count = 0;
+            if (std::sscanf(value, "%u/%u", &index, &count) != 2 || count == 0) return false;
+            options.shard_index = index;
+            options.shard_count = count;
+        } else if (arg == "--repeat") {
+            options.repeat = static_cast<unsigned>(std::max(0, std::atoi(value)));
+        } else if (arg == "--slowest") {
+            options.slowest = static_cast<unsigned>(std::atoi(value));
+        } else {
+            return false;
+        }
+    }
+    return options.shard_index < options.shard_count;
+}
+
+std::vector<const TestCase*> selectTests(const RunnerOptions& options) {
+    std::vector<const TestCase*> selected;
+    unsigned index = 0;
+    for (const auto& test : test_cases) {
+        std::string full_name = test.suite + "::" + test.name;
+        if (!options.filter.empty() && full_name.find(options.filter) == std::string::npos) continue;
+        // Round-robin after filtering keeps shards balanced
+        if (index++ % options.shard_count != options.shard_index) continue;
+        selected.push_back(&test);
+    }
+    return selected;
+}
+
+TestResult runOne(const TestCase& test) {
+    TestResult result;
+    result.test = &test;
+    auto start = std::chrono::steady_clock::now();
+    try {
+        setUp();
+        test.test_func();
+        tearDown();
+        result.passed = true;
+    } catch (const std::exception& e) {
+        result.message = e.what();
+    } catch (...) {
+        result.message = "unknown exception";
+    }
+    result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+/**
+ * Run the tests on a pool of workers pulling from a shared index. Fake
+ * state is thread_local and reset in setUp(), so tests on different
+ * workers cannot see each other's calls.
+ */
+std::vector<TestResult> runAll(const std::vector<const TestCase*>& tests, unsigned jobs) {
+    std::vector<TestResult> results(tests.size());
+    std::atomic<size_t> next{0};
+    std::mutex output_mutex;
+
+    auto worker = [&]() {
+        for (size_t i = next.fetch_add(1); i < tests.size(); i = next.fetch_add(1)) {
+            results[i] = runOne(*tests[i]);
+            std::lock_guard<std::mutex> lock(output_mutex);
+            const TestResult& r = results[i];
+            std::cout << (r.passed ? "PASS " : "FAIL ") << r.test->suite << "::" << r.test->name
+                      << " (" << r.ms << " ms)" << std::endl;
+            if (!r.passed) {
+                std::cout << "  " << r.message << std::endl;
+            }
+        }
+    };
+
+    jobs = std::max(1u, std::min<unsigned>(jobs, static_cast<unsigned>(tests.size())));
+    std::vector<std::thread> pool;
+    for (unsigned j = 1; j < jobs; j++) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : pool) t.join();
+    return results;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    RunnerOptions options;
+    if (!parseArgs(argc, argv, options)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    std::vector<const TestCase*> tests = selectTests(options);
+    if (options.list) {
+        for (const TestCase* test : tests) {
+            std::cout << test->suite << "::" << test->name << std::endl;
+        }
+        return 0;
+    }
+
+    unsigned jobs = options.jobs != 0 ? options.jobs : std::thread::hardware_concurrency();
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Running embedded HAL unit tests (" << tests.size() << " tests, "
+              << std::max(1u, jobs) << " jobs, shard " << options.shard_index << "/"
+              << options.shard_count << ")...\n" << std::endl;
+
     int passed = 0;
     int failed = 0;
-    
-    for (const auto& test : test_cases) {
-        std::cout << "Running " << test.suite << "::" << test.name << "... ";
-        
-        try {
-            setUp();
-            test.test_func();
-            tearDown();
-            std::cout << "PASS" << std::endl;
-            passed++;
-        } catch (const std::exception& e) {
-            std::cout << "FAIL" << std::endl;
-            std::cout << "  " << e.what() << std::endl;
-            failed++;
+    std::vector<TestResult> results;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned iteration = 1; options.repeat == 0 || iteration <= options.repeat; iteration++) {
+        if (options.repeat != 1) {
+            std::cout << "--- Iteration " << iteration << " ---" << std::endl;
+        }
+        results = runAll(tests, jobs);
+        passed = 0;
+        failed = 0;
+        for (const auto& r : results) {
+            r.passed ? passed++ : failed++;
+        }
+        if (failed > 0) break;
+    }
+    double wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // Per-test cost of the last iteration, most expensive first
+    std::sort(results.begin(), results.end(),
+              [](const TestResult& a, const TestResult& b) { return a.ms > b.ms; });
+    size_t shown = options.slowest == 0 ? results.size() : std::min<size_t>(options.slowest, results.size());
+    if (shown > 0) {
+        std::cout << "\nSlowest tests:" << std::endl;
+        for (size_t i = 0; i < shown; i++) {
+            std::cout << "  " << results[i].ms << " ms  " << results[i].test->suite << "::"
+                      << results[i].test->name << std::endl;
         }
     }
-    
+
     std::cout << "\nTest Results:" << std::endl;
     std::cout << "  Passed: " << passed << std::endl;
     std::cout << "  Failed: " << failed << std::endl;
     std::cout << "  Total:  " << (passed + failed) << std::endl;
-    
+    std::cout << "  Wall:   " << wall_ms << " ms" << std::endl;
+
     return failed == 0 ? 0 : 1;
 }
 
@@ -50,7 +220,7 @@ extern "C" {
         extern void reset_all_mocks();
         reset_all_mocks();
     }
-    
+
     void tearDown() {
         // Cleanup after each test if needed
     }
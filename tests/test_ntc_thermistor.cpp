@@ -0,0 +1,49 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "NtcSensor.hpp"
+#include <cmath>
+
+using SteinhartHartTable = NtcTable<ntc::SteinhartHartEquation<Ntc10kSteinhartHart>,
+                                    ntc::LowSideDivider<Divider10k12Bit>>;
+
+// Accuracy budget checked at compile time: the table is the calibration
+static_assert(Ntc10kTable::maxError(-40.0, 125.0) < 0.35, "full-range table error budget");
+static_assert(Ntc10kTable::maxError(0.0, 60.0) < 0.01, "operating-range table error budget");
+
+ZTEST(ntc_thermistor, constexpr_ln_matches_libm)
+{
+    const double values[] = {1e-6, 0.5, 1.0, 1.5, 2.0, 10.0, 10000.0, 3.3e7};
+    for (double x : values) {
+        zassert_true(std::fabs(ntc::ln(x) - std::log(x)) < 1e-12, "ln accuracy");
+    }
+}
+
+ZTEST(ntc_thermistor, nominal_point_is_exact)
+{
+    // Equal divider resistors: mid-scale code is R = R0, i.e. 25 °C
+    zassert_true(std::fabs(Ntc10kTable::exact(2048.0) - 25.0) < 1e-9, "Beta equation at R0");
+    zassert_true(std::fabs(Ntc10kTable::toCelsius(2048) - 25.0f) < 1e-4f, "Table at R0");
+    zassert_true(std::fabs(SteinhartHartTable::toCelsius(2048) - 25.0f) < 0.01f, "Steinhart-Hart at R0");
+}
+
+ZTEST(ntc_thermistor, table_tracks_exact_curve)
+{
+    for (uint32_t code = 400; code < 3700; code += 7) {
+        double truth = Ntc10kTable::exact(code);
+        double table = Ntc10kTable::toCelsius(static_cast<uint16_t>(code));
+        zassert_true(std::fabs(table - truth) < 0.35, "Table within budget");
+    }
+    // Low-side NTC: a higher code means more resistance, i.e. colder
+    zassert_true(Ntc10kTable::toCelsius(1000) > Ntc10kTable::toCelsius(3000), "Curve is decreasing");
+}
+
+ZTEST(ntc_thermistor, sensor_converts_driver_reading)
+{
+    reset_all_fakes();
+    MockAdcDriver adc;
+    NtcSensor<> sensor(adc);
+
+    adc_read_raw_fake.return_val = 2048;
+    zassert_float_equal(sensor.readValue(), 25.0f, "Mid-scale reads 25 °C");
+    zassert_equal(adc_read_raw_fake.call_count, 1u, "One conversion per read");
+}
@@ -0,0 +1,161 @@
+#include "ztest_framework.hpp"
+#include "PeriodicScheduler.hpp"
+#include <string>
+#include <vector>
+
+namespace {
+
+// Virtual microsecond clock that tasks advance by their execution time
+struct VirtualClock {
+    uint64_t now = 0;
+
+    static uint64_t read(void* context) {
+        return static_cast<VirtualClock*>(context)->now;
+    }
+};
+
+struct Probe {
+    VirtualClock* clock;
+    std::string* trace;
+    char tag;
+    uint32_t exec_us;
+    std::vector<uint64_t> releases;
+};
+
+void probeTask(void* context, uint64_t release_us) {
+    Probe* probe = static_cast<Probe*>(context);
+    probe->releases.push_back(release_us);
+    if (probe->trace) *probe->trace += probe->tag;
+    probe->clock->now += probe->exec_us;
+}
+
+// Sleep until the next release (never earlier than now) and run
+void step(PeriodicScheduler& scheduler, VirtualClock& clock) {
+    if (scheduler.nextRelease() > clock.now) clock.now = scheduler.nextRelease();
+    scheduler.runDue();
+}
+
+} // namespace
+
+ZTEST(periodic_scheduler, rate_monotonic_order)
+{
+    VirtualClock clock;
+    std::string trace;
+    PeriodicScheduler scheduler(&VirtualClock::read, &clock);
+    Probe slow{&clock, &trace, 'S', 300, {}};
+    Probe fast{&clock, &trace, 'F', 100, {}};
+    Probe medium{&clock, &trace, 'M', 200, {}};
+    scheduler.add("slow", 10000, probeTask, &slow);
+    scheduler.add("fast", 1000, probeTask, &fast);
+    scheduler.add("medium", 5000, probeTask, &medium);
+    scheduler.start(0);
+
+    step(scheduler, clock);
+    zassert_true(trace == "FMS", "Shortest period runs first");
+
+    // Fast released at 1000 while slow ran (600 us busy): only fast is due
+    trace.clear();
+    step(scheduler, clock);
+    zassert_true(trace == "F", "Fast task alone at its next release");
+    zassert_equal(fast.releases[1], 1000u, "Released on the grid");
+    zassert_equal(scheduler.getStats(1).latency_us.max(), 0u, "No start latency for the fast task");
+    zassert_equal(scheduler.getStats(0).latency_us.max(), 300u, "Slow task waited for fast and medium");
+}
+
+ZTEST(periodic_scheduler, zero_drift_over_a_million_periods)
+{
+    VirtualClock clock;
+    PeriodicScheduler scheduler(&VirtualClock::read, &clock);
+    Probe control{&clock, nullptr, 'C', 0, {}};
+    int id = scheduler.add("control", 1000, probeTask, &control);
+    scheduler.start(12345);
+
+    // Varying execution time and wake-up latency; a relative sleep
+    // (run, then sleep one period) would drift by their sum
+    uint32_t lcg = 1;
+    uint64_t relative_drift = 0;
+    bool on_grid = true;
+    const uint64_t periods = 1000000;
+    for (uint64_t n = 0; n < periods; n++) {
+        lcg = lcg * 1664525u + 1013904223u;
+        control.exec_us = 50 + (lcg >> 8) % 400;
+        control.releases.clear();
+        uint64_t wake = scheduler.nextRelease() + (lcg >> 20) % 100;
+        clock.now = wake;
+        scheduler.runDue();
+        on_grid = on_grid && control.releases.size() == 1 && control.releases[0] == 12345 + n * 1000;
+        relative_drift += control.exec_us + (wake - (12345 + n * 1000));
+    }
+    zassert_true(on_grid, "Every release exactly on start + n * period");
+    zassert_equal(scheduler.nextRelease(), 12345 + periods * 1000, "No cumulative drift");
+    zassert_equal(scheduler.getStats(id).overruns, 0u, "No overruns under the period");
+    zassert_true(relative_drift > periods * 250, "A relative sleep would have drifted by minutes");
+    zassert_true(scheduler.getStats(id).latency_us.percentile(99.0f) < 100, "Jitter bounded by the wake-up latency");
+}
+
+ZTEST(periodic_scheduler, overrun_skips_missed_releases)
+{
+    VirtualClock clock;
+    PeriodicScheduler scheduler(&VirtualClock::read, &clock);
+    Probe task{&clock, nullptr, 'T', 2500, {}};
+    int id = scheduler.add("task", 1000, probeTask, &task);
+    scheduler.start(0);
+
+    scheduler.runDue();     // 0..2500: overruns, the release at 1000 is lost
+    zassert_equal(scheduler.getStats(id).overruns, 1u, "Finished after its deadline");
+    zassert_equal(scheduler.getStats(id).skipped, 1u, "Fully missed release skipped");
+    zassert_equal(scheduler.nextRelease(), 2000u, "Still on the grid");
+
+    task.exec_us = 100;
+    scheduler.runDue();     // Release 2000 runs late at 2500, then it is caught up
+    zassert_equal(task.releases.back(), 2000u, "Late release keeps its grid time");
+    zassert_equal(scheduler.getStats(id).latency_us.max(), 500u, "Lateness recorded as latency");
+    zassert_equal(scheduler.getStats(id).runs, 2u, "No back-to-back catch-up runs");
+
+    // Permanently overloaded: one run per call, the rest skipped
+    task.exec_us = 5000;
+    clock.now = scheduler.nextRelease();
+    zassert_equal(scheduler.runDue(), 1u, "runDue() returns despite the overload");
+    zassert_equal(scheduler.getStats(id).skipped, 5u, "Four more releases skipped");
+    zassert_equal(scheduler.nextRelease(), 8000u, "Next release on the grid");
+}
+
+ZTEST(periodic_scheduler, period_change_rephases_from_last_release)
+{
+    VirtualClock clock;
+    PeriodicScheduler scheduler(&VirtualClock::read, &clock);
+    struct Adaptive {
+        PeriodicScheduler* scheduler;
+        VirtualClock* clock;
+        std::vector<uint64_t> releases;
+    } adaptive{&scheduler, &clock, {}};
+    int id = scheduler.add("adaptive", 1000, [](void* context, uint64_t release_us) {
+        Adaptive* self = static_cast<Adaptive*>(context);
+        self->releases.push_back(release_us);
+        self->clock->now += 300;
+        self->scheduler->setPeriod(0, 250 * static_cast<uint32_t>(self->releases.size() + 1));
+    }, &adaptive);
+    scheduler.start(0);
+
+    for (int i = 0; i < 4; i++) {
+        step(scheduler, clock);
+    }
+    // Periods 500, 750, 1000 set from inside the task
+    zassert_equal(adaptive.releases[1], 500u, "First change from release 0");
+    zassert_equal(adaptive.releases[2], 1250u, "Second from release 500");
+    zassert_equal(adaptive.releases[3], 2250u, "Third from release 1250");
+
+    scheduler.setPeriod(id, 100);
+    zassert_equal(scheduler.nextRelease(), 2250u + 100u, "External change moves the pending release");
+}
+
+ZTEST(periodic_scheduler, rejects_bad_tasks)
+{
+    PeriodicScheduler scheduler;
+    zassert_equal(scheduler.add("zero", 0, probeTask, nullptr), -1, "Zero period refused");
+    for (size_t i = 0; i < PeriodicScheduler::kMaxTasks; i++) {
+        zassert_equal(scheduler.add("t", 1000, probeTask, nullptr), static_cast<int>(i), "Ids in order");
+    }
+    zassert_equal(scheduler.add("full", 1000, probeTask, nullptr), -1, "Table full");
+    zassert_equal(scheduler.nextRelease(), 0u, "Unstarted tasks are due at once");
+}
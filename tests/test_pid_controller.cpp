@@ -192,3 +192,60 @@ ZTEST(pid_controller, gains_update) {
     zassert_equal(config.ki, 0.2f, "Ki should be updated");
     zassert_equal(config.kd, 0.8f, "Kd should be updated");
 }
+
+// Test 12: Interval-scaled update
+ZTEST(pid_controller, update_with_interval) {
+    PIDController::Config config;
+    config.kp = 0.0f;
+    config.ki = 1.0f;
+    config.kd = 0.0f;
+    config.setpoint = 25.0f;
+
+    PIDController single(config);
+    PIDController stepped(config);
+
+    single.update(27.0f, 3.0f);
+    for (int i = 0; i < 3; i++) stepped.update(27.0f);
+
+    zassert_float_equal(single.getState().integral, stepped.getState().integral,
+                        "dt=3 should integrate like three unit steps");
+}
+
+// Test 13: Held cycles keep the integral exact
+ZTEST(pid_controller, hold_integrates_without_output) {
+    PIDController::Config config;
+    config.kp = 1.0f;
+    config.ki = 0.5f;
+    config.kd = 2.0f;
+    config.setpoint = 25.0f;
+
+    PIDController pid(config);
+    float output = pid.update(28.0f);        // error -3
+    pid.hold(28.5f);                          // error -3.5
+    pid.hold(29.0f);                          // error -4
+    zassert_equal(pid.getState().output, output, "Hold should not change the output");
+    zassert_float_equal(pid.getState().integral, -10.5f, "Hold should integrate each sample");
+
+    pid.update(29.0f);                        // error -4 over 3 cycles
+    zassert_float_equal(pid.getState().integral, -14.5f, "Update should add its own sample");
+    zassert_float_equal(pid.getState().derivative, -1.0f / 3.0f, "Derivative should span held cycles");
+    zassert_float_equal(pid.getState().held_time, 0.0f, "Update should clear held time");
+}
+
+// Test 14: Supplied slope replaces the difference of two samples
+ZTEST(pid_controller, update_with_rate_uses_supplied_slope) {
+    PIDController::Config config;
+    config.kp = 0.0f;
+    config.ki = 0.0f;
+    config.kd = 20.0f;
+    config.setpoint = 25.0f;
+
+    PIDController pid(config);
+    float output = pid.updateWithRate(26.0f, 0.5f, 1.0f);   // Heating at 0.5 °C/s
+    zassert_float_equal(pid.getState().derivative, -0.5f, "Derivative is minus the slope");
+    zassert_float_equal(output, 10.0f, "First update already has a D term");
+
+    pid.updateWithRate(30.0f, 0.0f, 1.0f);                  // 4 °C jump, flat slope
+    zassert_float_equal(pid.getState().d_term, 0.0f, "Reading jump does not kick the D term");
+    zassert_equal(pid.getState().update_count, 2u, "Counted like update()");
+}
@@ -0,0 +1,205 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "mocks/stub_sensor.hpp"
+#include "PlantIdentifier.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include <cmath>
+
+namespace {
+
+// Uniform noise in [-amplitude, amplitude], deterministic
+struct Noise {
+    uint32_t state = 1;
+    float next(float amplitude) {
+        state = state * 1664525u + 1013904223u;
+        return amplitude * (((state >> 8) & 0xFFFF) / 32767.5f - 1.0f);
+    }
+};
+
+// y[k] = a y[k-1] + b u[k-1-delay] + c, with u in percent and b per fraction
+struct ArxPlant {
+    float a;
+    float b;
+    float c;
+    int delay;
+    float y = 30.0f;
+    float inputs[8] = {};
+
+    float step(float u) {
+        for (int i = 7; i > 0; i--) inputs[i] = inputs[i - 1];
+        inputs[0] = u;
+        y = a * y + b * 0.01f * inputs[delay] + c;
+        return y;
+    }
+};
+
+// Output switched every @p hold samples between two levels
+float excitation(int k, int hold) {
+    uint32_t x = static_cast<uint32_t>(k / hold) * 2654435761u;
+    return (x >> 16) & 1 ? 70.0f : 30.0f;
+}
+
+} // namespace
+
+ZTEST(plant_identifier, converges_on_first_order_plant_with_delay)
+{
+    // tau = 20 s at dt = 1 s, gain -0.2 °C/%, two samples of dead time
+    const float a = std::exp(-1.0f / 20.0f);
+    ArxPlant plant{a, -20.0f * (1.0f - a), 0.5f, 2};
+    PlantIdentifier identifier;
+    Noise noise;
+    float u = 50.0f;
+    for (int k = 0; k < 1500; k++) {
+        float y = plant.step(u);
+        identifier.update(y + noise.next(0.05f), u, 1.0f);
+        u = excitation(k, 15);
+    }
+
+    PlantIdentifier::Model model = identifier.model();
+    zassert_true(model.valid, "Model reported after warm-up");
+    zassert_true(std::fabs(model.gain + 0.2f) < 0.02f, "Gain within 10%");
+    zassert_true(std::fabs(model.time_constant - 20.0f) < 2.0f, "Time constant within 10%");
+    zassert_float_equal(model.dead_time, 2.0f, "Dead time picked from the candidates");
+}
+
+ZTEST(plant_identifier, time_constant_right_after_interval_change)
+{
+    // tau = 20 s, gain -0.2 °C/%, 2 s dead time: at dt = 1 s, then 2 s
+    const float a1 = std::exp(-1.0f / 20.0f);
+    ArxPlant plant{a1, -20.0f * (1.0f - a1), 0.5f, 2};
+    PlantIdentifier identifier;
+    Noise noise;
+    float u = 50.0f;
+    for (int k = 0; k < 1500; k++) {
+        identifier.update(plant.step(u) + noise.next(0.05f), u, 1.0f);
+        u = excitation(k, 15);
+    }
+    zassert_true(std::fabs(identifier.model().time_constant - 20.0f) < 2.0f, "Fitted at 1 s");
+
+    const float a2 = std::exp(-2.0f / 20.0f);
+    plant.a = a2;
+    plant.b = -20.0f * (1.0f - a2);
+    plant.delay = 1;
+    for (int k = 0; k < 300; k++) {
+        identifier.update(plant.step(u) + noise.next(0.05f), u, 2.0f);
+        u = excitation(k, 8);
+    }
+    PlantIdentifier::Model model = identifier.model();
+    zassert_equal(identifier.getStats().restarts, 1u, "Interval change detected");
+    zassert_true(model.valid, "Model reported after a new warm-up");
+    zassert_true(std::fabs(model.time_constant - 20.0f) < 2.0f, "Time constant within 10% at the new interval");
+    zassert_true(std::fabs(model.gain + 0.2f) < 0.02f, "Gain within 10%");
+    zassert_float_equal(model.dead_time, 2.0f, "Dead time in seconds unchanged");
+}
+
+ZTEST(plant_identifier, forgetting_follows_a_gain_change)
+{
+    const float a = std::exp(-2.0f / 20.0f);
+    ArxPlant plant{a, -20.0f * (1.0f - a), 0.0f, 1};
+    PlantIdentifier identifier;
+    float u = 50.0f;
+    for (int k = 0; k < 5000; k++) {
+        if (k == 1000) plant.b *= 0.5f;     // Fan loses half its effect
+        identifier.update(plant.step(u), u, 2.0f);
+        u = excitation(k, 10);
+    }
+    zassert_true(std::fabs(identifier.model().gain + 0.1f) < 0.01f, "New gain tracked");
+}
+
+ZTEST(plant_identifier, safeguards_without_excitation)
+{
+    PlantIdentifier identifier;
+    for (int k = 0; k < 20000; k++) {
+        identifier.update(28.0f, 40.0f, 1.0f);
+    }
+    PlantIdentifier::Model model = identifier.model();
+    zassert_true(std::isfinite(model.a) && std::isfinite(model.b), "Parameters stay finite");
+    zassert_true(identifier.getStats().trace_clamps > 0, "Covariance growth capped");
+    PIDController::Config current;
+    PIDController::Config proposed;
+    zassert_false(model.valid && identifier.propose(current, proposed) && proposed.kp > current.kp * 1.21f,
+                  "No unbounded proposal");
+
+    // A different interval restarts the regressor and the warm-up
+    identifier.update(28.0f, 40.0f, 5.0f);
+    zassert_equal(identifier.getStats().restarts, 1u, "Interval change detected");
+    zassert_false(identifier.model().valid, "Warm-up again before reporting");
+}
+
+ZTEST(plant_identifier, proposes_simc_gains_with_rate_limit)
+{
+    const float a = std::exp(-1.0f / 20.0f);
+    ArxPlant plant{a, -20.0f * (1.0f - a), 0.0f, 1};
+    PlantIdentifier identifier;
+    float u = 50.0f;
+    for (int k = 0; k < 1000; k++) {
+        identifier.update(plant.step(u), u, 1.0f);
+        u = excitation(k, 15);
+    }
+
+    // theta = 1.5 s, tau_c = max(1.5, 10) = 10: kp = 20 / (0.2 * 11.5), ti = min(20, 46)
+    PIDController::Config unset;
+    unset.kp = 0.0f;
+    unset.ki = 0.0f;
+    PIDController::Config proposed;
+    zassert_true(identifier.propose(unset, proposed), "Valid model gives a proposal");
+    zassert_true(std::fabs(proposed.kp - 8.7f) < 0.3f, "SIMC proportional gain");
+    zassert_true(std::fabs(proposed.ki - 0.435f) < 0.02f, "SIMC integral gain");
+    zassert_float_equal(proposed.kd, unset.kd, "Derivative gain kept");
+
+    PIDController::Config current;
+    current.kp = 2.0f;
+    current.ki = 1.0f;
+    identifier.propose(current, proposed);
+    zassert_float_equal(proposed.kp, 2.4f, "Increase limited to 20%");
+    zassert_float_equal(proposed.ki, 0.8f, "Decrease limited to 20%");
+}
+
+ZTEST(plant_identifier, controller_applies_gains_bumplessly)
+{
+    StubSensor sensor;
+    MockPwmDriver pwm;
+    VariableFan fan(pwm);
+    MockUartDriver uart;
+    UartLogger logger(uart);
+    PIDController::Config config;
+    config.kp = 4.0f;
+    config.ki = 0.2f;
+    config.kd = 0.0f;
+    config.setpoint = 28.0f;
+    config.integral_max = config.output_max / config.ki;
+    AdvancedTemperatureController controller(sensor, fan, logger, config);
+    controller.setDetailedTrace(false);
+    PlantIdentifier identifier;
+    controller.setIdentifier(&identifier, 20);
+
+    // Closed loop around the ARX plant; the fan output drives u
+    const float a = std::exp(-1.0f / 20.0f);
+    ArxPlant plant{a, -20.0f * (1.0f - a), 40.0f * (1.0f - a), 1};  // 40 °C with the fan off
+    Noise noise;
+    float max_step = 0.0f;
+    for (int k = 0; k < 2000; k++) {
+        if (k % 200 == 0) controller.setSetpoint(k % 400 ? 30.0f : 28.0f);
+        uint32_t before = controller.getStatistics().gain_adaptations;
+        float i_term = controller.getPIDState().i_term;
+        sensor.value = plant.y + noise.next(0.02f);
+        controller.regulate(1.0f);
+        plant.step(fan.getOutput());
+        if (controller.getStatistics().gain_adaptations != before) {
+            // Retuned this cycle: compare the integral term across the next one
+            i_term = controller.getPIDState().i_term;
+            sensor.value = plant.y;
+            controller.regulate(1.0f);
+            plant.step(fan.getOutput());
+            float error = controller.getPIDState().error;
+            max_step = std::max(max_step, std::fabs(controller.getPIDState().i_term - i_term -
+                                                    controller.getActiveConfig().ki * error));
+        }
+    }
+    zassert_true(controller.getStatistics().gain_adaptations > 0, "Gains adapted");
+    zassert_true(controller.getActiveConfig().kp > config.kp, "Loop sped up towards SIMC gains");
+    zassert_float_equal(controller.getSetpoint(), 30.0f, "Setpoint writes not lost");
+    zassert_true(max_step < 0.01f, "No output bump from the integral term");
+}
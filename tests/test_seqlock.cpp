@@ -0,0 +1,154 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "SeqLock.hpp"
+#include "AdcSensor.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include <atomic>
+#include <thread>
+
+#define UartDriver MockUartDriver
+
+struct Triple {
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+};
+
+ZTEST(seqlock, write_then_read_returns_value)
+{
+    SeqLock<Triple> lock(Triple{1, 2, 3});
+    uint32_t initial = lock.version();
+
+    lock.write(Triple{4, 5, 6});
+    Triple value = lock.read();
+
+    zassert_equal(value.a, 4u, "First word published");
+    zassert_equal(value.c, 6u, "Last word published");
+    zassert_equal(lock.version(), initial + 2, "One completed write advances the version by two");
+}
+
+ZTEST(seqlock, update_modifies_in_place)
+{
+    SeqLock<Triple> lock(Triple{1, 2, 3});
+    lock.update([](Triple& t) { t.b = 20; });
+
+    Triple value = lock.read();
+    zassert_equal(value.a, 1u, "Untouched field kept");
+    zassert_equal(value.b, 20u, "Field modified");
+}
+
+ZTEST(seqlock, try_write_never_waits)
+{
+    SeqLock<Triple> lock(Triple{1, 2, 3});
+    uint32_t version = lock.version();
+    zassert_true(lock.tryWrite(Triple{4, 5, 6}, version), "Publishes at the expected version");
+    zassert_equal(lock.read().a, 4u, "Value published");
+
+    zassert_false(lock.tryWrite(Triple{7, 8, 9}, version), "Stale version refused");
+    bool published_while_locked = true;
+    lock.update([&](Triple& t) {
+        // Another writer holds the lock: refused at once instead of spinning
+        published_while_locked = lock.tryWrite(Triple{7, 8, 9}, version + 2);
+        t.c = 60;
+    });
+    zassert_false(published_while_locked, "Refused while a writer holds the lock");
+    Triple value = lock.read();
+    zassert_equal(value.a, 4u, "Refused writes left no trace");
+    zassert_equal(value.c, 60u, "Lock holder's write kept");
+}
+
+ZTEST(seqlock, concurrent_readers_never_see_torn_values)
+{
+    SeqLock<Triple> lock(Triple{0, 0, 0});
+    std::atomic<bool> stop{false};
+    std::atomic<uint32_t> torn{0};
+
+    std::thread reader([&]() {
+        while (!stop.load(std::memory_order_relaxed)) {
+            Triple t;
+            if (lock.tryRead(t) && (t.b != t.a * 2 || t.c != t.a * 3)) {
+                torn++;
+            }
+        }
+    });
+    for (uint32_t i = 1; i <= 20000; i++) {
+        lock.write(Triple{i, i * 2, i * 3});
+    }
+    stop = true;
+    reader.join();
+
+    zassert_equal(torn.load(), 0u, "Readers only see complete writes");
+}
+
+ZTEST(seqlock, concurrent_writers_lose_no_updates)
+{
+    SeqLock<Triple> lock(Triple{0, 0, 0});
+    const uint32_t kUpdates = 20000;
+    auto writer = [&]() {
+        for (uint32_t i = 0; i < kUpdates; i++) {
+            lock.update([](Triple& t) {
+                t.a++;
+                t.c++;
+            });
+        }
+    };
+    std::thread first(writer);
+    std::thread second(writer);
+    first.join();
+    second.join();
+
+    Triple value = lock.read();
+    zassert_equal(value.a, 2 * kUpdates, "Writers serialized: every increment kept");
+    zassert_equal(value.c, 2 * kUpdates, "Last word too");
+}
+
+ZTEST(seqlock, controller_applies_config_at_cycle_boundary)
+{
+    reset_all_fakes();
+    MockAdcDriver adc;
+    MockPwmDriver pwm;
+    MockUartDriver uart;
+    AdcSensor sensor(adc);
+    VariableFan fan(pwm);
+    UartLogger logger(uart);
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+
+    controller.setSetpoint(30.0f);
+    controller.tunePID(3.0f, 0.2f, 0.4f);
+    zassert_float_equal(controller.getSetpoint(), 30.0f, "Published setpoint visible to writers");
+    zassert_float_equal(controller.getActiveConfig().setpoint, 25.0f, "Loop still on the old config");
+
+    adc_read_raw_fake.return_val = 372;
+    controller.regulate();
+    zassert_float_equal(controller.getActiveConfig().setpoint, 30.0f, "Setpoint applied at regulate()");
+    zassert_float_equal(controller.getActiveConfig().kp, 3.0f, "Gains applied with it");
+}
+
+ZTEST(seqlock, controller_snapshot_matches_loop_state)
+{
+    reset_all_fakes();
+    MockAdcDriver adc;
+    MockPwmDriver pwm;
+    MockUartDriver uart;
+    AdcSensor sensor(adc);
+    VariableFan fan(pwm);
+    UartLogger logger(uart);
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+
+    adc_read_raw_fake.return_val = 372;
+    controller.regulate();
+    controller.regulate();
+
+    AdvancedTemperatureController::Snapshot snap = controller.snapshot();
+    zassert_equal(snap.stats.total_cycles, 2u, "Snapshot taken after the last cycle");
+    zassert_float_equal(snap.pid.output, controller.getPIDState().output, "PID state copied");
+    zassert_float_equal(snap.setpoint, 25.0f, "Active setpoint copied");
+
+    controller.setSnapshotPublishing(false);
+    controller.regulate();
+    zassert_equal(controller.snapshot().stats.total_cycles, 2u, "Disabled publishing keeps the last snapshot");
+}
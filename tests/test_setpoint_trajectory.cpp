@@ -0,0 +1,134 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "mocks/stub_sensor.hpp"
+#include "SetpointTrajectory.hpp"
+#include "SetpointSchedule.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include <cmath>
+
+namespace {
+
+SetpointTrajectory::Config profile(SetpointTrajectory::Profile kind) {
+    SetpointTrajectory::Config config;
+    config.profile = kind;
+    return config;
+}
+
+constexpr SchedulePoint kDay[] = {
+    schedulePoint(6, 30, 24.0f),
+    schedulePoint(12, 0, 25.5f),
+    schedulePoint(19, 0, 27.0f),
+};
+static_assert(SetpointSchedule(kDay).valid(), "Sorted within one day");
+static_assert(SetpointSchedule(kDay).at(12 * 60) == 25.5f, "Evaluated at compile time");
+
+} // namespace
+
+ZTEST(setpoint_trajectory, step_jumps_at_once)
+{
+    SetpointTrajectory trajectory(profile(SetpointTrajectory::Profile::Step), 25.0f);
+    trajectory.setTarget(28.0f);
+    zassert_float_equal(trajectory.update(1.0f), 28.0f, "Target reached in one update");
+    zassert_true(trajectory.settled(), "Settled");
+}
+
+ZTEST(setpoint_trajectory, ramp_limits_rate)
+{
+    SetpointTrajectory trajectory(profile(SetpointTrajectory::Profile::Ramp), 25.0f);
+    trajectory.setTarget(24.0f);
+    float last = trajectory.value();
+    int updates = 0;
+    while (!trajectory.settled() && updates < 1000) {
+        float value = trajectory.update(1.0f);
+        zassert_true(std::fabs(value - last) <= 0.02f + 1e-6f, "At most max_rate per second");
+        zassert_true(value >= 24.0f, "Never past the target");
+        last = value;
+        updates++;
+    }
+    zassert_float_equal(trajectory.value(), 24.0f, "Target reached");
+    zassert_true(updates >= 50 && updates <= 51, "1 °C at 0.02 °C/s takes 50 s");
+}
+
+ZTEST(setpoint_trajectory, scurve_limits_rate_and_acceleration)
+{
+    SetpointTrajectory trajectory(profile(SetpointTrajectory::Profile::SCurve), 25.0f);
+    trajectory.setTarget(27.0f);
+    float last_rate = 0.0f;
+    int updates = 0;
+    while (!trajectory.settled() && updates < 1000) {
+        trajectory.update(0.5f);
+        zassert_true(std::fabs(trajectory.rate()) <= 0.02f + 1e-6f, "Rate capped at max_rate");
+        if (!trajectory.settled()) {
+            zassert_true(std::fabs(trajectory.rate() - last_rate) <= 0.001f * 0.5f + 1e-6f,
+                         "Rate changes by at most max_accel * dt");
+        }
+        zassert_true(trajectory.value() <= 27.0f, "No overshoot");
+        last_rate = trajectory.rate();
+        updates++;
+    }
+    zassert_float_equal(trajectory.value(), 27.0f, "Target reached");
+    // 2 °C: 20 s up to full rate, 80 s cruising, 20 s braking
+    zassert_true(updates * 0.5f >= 110.0f && updates * 0.5f <= 130.0f, "About 120 s");
+}
+
+ZTEST(setpoint_trajectory, new_target_mid_move_is_continuous)
+{
+    SetpointTrajectory trajectory(profile(SetpointTrajectory::Profile::SCurve), 25.0f);
+    trajectory.setTarget(28.0f);
+    for (int i = 0; i < 40; i++) trajectory.update(1.0f);
+    float value = trajectory.value();
+    float rate = trajectory.rate();
+    zassert_true(rate > 0.0f, "Moving up");
+
+    trajectory.setTarget(24.0f);
+    trajectory.update(1.0f);
+    zassert_true(std::fabs(trajectory.value() - value) <= 0.02f + 1e-6f, "No jump in the setpoint");
+    zassert_true(std::fabs(trajectory.rate() - rate) <= 0.001f + 1e-6f, "No jump in its slope");
+
+    for (int i = 0; i < 1000 && !trajectory.settled(); i++) trajectory.update(1.0f);
+    zassert_float_equal(trajectory.value(), 24.0f, "Reaches the new target");
+}
+
+ZTEST(setpoint_trajectory, schedule_lookup)
+{
+    const SetpointSchedule schedule(kDay);
+    zassert_equal(schedule.size(), 3u, "Three points");
+    zassert_float_equal(schedule.at(3 * 60), 27.0f, "Before the first point: previous day's last");
+    zassert_float_equal(schedule.at(6 * 60 + 30), 24.0f, "Change at the point's minute");
+    zassert_float_equal(schedule.at(18 * 60 + 59), 25.5f, "Holds until the next point");
+    zassert_equal(schedule.nextChange(7 * 60), 12 * 60, "Next change today");
+    zassert_equal(schedule.nextChange(20 * 60), 6 * 60 + 30, "Next change wraps to tomorrow");
+
+    constexpr SchedulePoint unsorted[] = {schedulePoint(8, 0, 24.0f), schedulePoint(7, 0, 25.0f)};
+    zassert_false(SetpointSchedule(unsorted).valid(), "Unsorted table rejected");
+}
+
+ZTEST(setpoint_trajectory, controller_ramps_pid_setpoint)
+{
+    reset_all_fakes();
+    StubSensor sensor;
+    VariableFan fan;
+    MockUartDriver uart;
+    UartLogger logger(uart);
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+    SetpointTrajectory::Config config = profile(SetpointTrajectory::Profile::Ramp);
+    SetpointTrajectory trajectory(config);
+    controller.setTrajectory(&trajectory);
+
+    controller.setSetpoint(23.0f);
+    controller.regulate(1.0f);
+    zassert_float_equal(controller.getSetpoint(), 23.0f, "Requested setpoint reported");
+    zassert_true(std::fabs(controller.getActiveConfig().setpoint - 24.98f) < 1e-4f, "PID moved one ramp step");
+    zassert_float_equal(trajectory.target(), 23.0f, "Trajectory heads for the request");
+
+    for (int i = 0; i < 200; i++) controller.regulate(1.0f);
+    zassert_float_equal(controller.getActiveConfig().setpoint, 23.0f, "PID at the request after the ramp");
+
+    controller.setTrajectory(nullptr);
+    controller.setSetpoint(26.0f);
+    controller.regulate(1.0f);
+    zassert_float_equal(controller.getActiveConfig().setpoint, 26.0f, "Steps again without a trajectory");
+}
@@ -0,0 +1,108 @@
+/**
+ * @file test_signal_pipeline.cpp
+ * @brief Unit tests for the compile-time signal-processing pipeline
+ */
+
+#include "ztest_framework.hpp"
+#include "mocks/stub_sensor.hpp"
+#include "SignalPipeline.hpp"
+#include "FilteredSensor.hpp"
+
+using namespace pipeline;
+
+namespace {
+struct TestCal { static constexpr float gain = 2.0f; static constexpr float offset = -1.0f; };
+struct HalfAlpha { static constexpr float alpha = 0.5f; };
+struct OneDegree { static constexpr float max_step = 1.0f; };
+}
+
+ZTEST(signal_pipeline, empty_pipeline_is_identity) {
+    using Pipe = SignalPipeline<>;
+    Pipe::State state{};
+    zassert_equal(Pipe::process(state, 42.5f), 42.5f, "Empty pipeline should pass samples through");
+}
+
+ZTEST(signal_pipeline, calibration_applies_gain_and_offset) {
+    using Pipe = SignalPipeline<Calibrate<TestCal>>;
+    Pipe::State state{};
+    zassert_float_equal(Pipe::process(state, 10.0f), 19.0f, "2 * 10 - 1 should be 19");
+}
+
+ZTEST(signal_pipeline, median_rejects_single_spike) {
+    using Pipe = SignalPipeline<MedianOf<3>>;
+    Pipe::State state{};
+    Pipe::process(state, 25.0f);
+    Pipe::process(state, 25.2f);
+    float out = Pipe::process(state, 80.0f); // spike
+    zassert_float_equal(out, 25.2f, "Median of three should reject a single spike");
+    out = Pipe::process(state, 25.1f);
+    zassert_float_equal(out, 25.2f, "Spike should still be rejected once it leaves the middle");
+}
+
+ZTEST(signal_pipeline, low_pass_primes_then_smooths) {
+    using Pipe = SignalPipeline<LowPass<HalfAlpha>>;
+    Pipe::State state{};
+    zassert_equal(Pipe::process(state, 20.0f), 20.0f, "First sample should prime the filter");
+    zassert_equal(Pipe::process(state, 30.0f), 25.0f, "alpha=0.5 should move half way");
+}
+
+ZTEST(signal_pipeline, rate_limit_bounds_step) {
+    using Pipe = SignalPipeline<RateLimit<OneDegree>>;
+    Pipe::State state{};
+    Pipe::process(state, 20.0f);
+    zassert_equal(Pipe::process(state, 30.0f), 21.0f, "Rise should be limited to 1 degree");
+    zassert_equal(Pipe::process(state, 10.0f), 20.0f, "Fall should be limited to 1 degree");
+}
+
+ZTEST(signal_pipeline, unit_conversion) {
+    using ToF = SignalPipeline<ConvertUnits<Unit::Celsius, Unit::Fahrenheit>>;
+    using ToK = SignalPipeline<ConvertUnits<Unit::Celsius, Unit::Kelvin>>;
+    ToF::State f{};
+    ToK::State k{};
+    zassert_float_equal(ToF::process(f, 100.0f), 212.0f, "100 C should be 212 F");
+    zassert_float_equal(ToK::process(k, 0.0f), 273.15f, "0 C should be 273.15 K");
+}
+
+ZTEST(signal_pipeline, stages_run_in_order) {
+    // Calibrate first, then rate limit: 2*10-1 = 19, then 2*20-1 = 39 limited to 20
+    using Pipe = SignalPipeline<Calibrate<TestCal>, RateLimit<OneDegree>>;
+    Pipe::State state{};
+    zassert_float_equal(Pipe::process(state, 10.0f), 19.0f, "First sample primes the limiter");
+    zassert_float_equal(Pipe::process(state, 20.0f), 20.0f, "Limiter should see calibrated value");
+}
+
+ZTEST(signal_pipeline, block_matches_per_sample) {
+    using Pipe = SignalPipeline<Calibrate<TestCal>, MedianOf<5>, LowPass<HalfAlpha>, RateLimit<OneDegree>>;
+    float input[16];
+    for (int i = 0; i < 16; i++) {
+        input[i] = 25.0f + (i % 4) * 0.7f - (i == 7 ? 30.0f : 0.0f);
+    }
+
+    Pipe::State per_sample{};
+    Pipe::State block{};
+    float expected[16];
+    float actual[16];
+    for (int i = 0; i < 16; i++) {
+        expected[i] = Pipe::process(per_sample, input[i]);
+    }
+    Pipe::processBlock(block, input, actual, 8);
+    Pipe::processBlock(block, input + 8, actual + 8, 8);
+
+    for (int i = 0; i < 16; i++) {
+        zassert_equal(actual[i], expected[i], "Block output should match per-sample output");
+    }
+}
+
+ZTEST(signal_pipeline, filtered_sensor_decorates_source) {
+    using Pipe = SignalPipeline<LowPass<HalfAlpha>>;
+    StubSensor stub;
+    FilteredSensor<Pipe> sensor(stub);
+
+    stub.value = 20.0f;
+    zassert_equal(sensor.readValue(), 20.0f, "First reading primes the filter");
+    stub.value = 24.0f;
+    zassert_equal(sensor.readValue(), 22.0f, "Second reading should be smoothed");
+
+    sensor.reset();
+    zassert_equal(sensor.readValue(), 24.0f, "Reset should discard filter history");
+}
@@ -0,0 +1,106 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "mocks/stub_sensor.hpp"
+#include "SmithPredictor.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include <cmath>
+
+namespace {
+
+// Step response of the model from rest, t seconds after the step
+float stepResponse(const SmithPredictor::Model& model, float step, float t) {
+    return t <= 0.0f ? 0.0f : model.gain * step * (1.0f - std::exp(-t / model.time_constant));
+}
+
+} // namespace
+
+ZTEST(smith_predictor, no_correction_at_rest)
+{
+    SmithPredictor predictor;
+    for (int i = 0; i < 100; i++) {
+        zassert_float_equal(predictor.update(27.0f, 40.0f, 1.0f), 27.0f, "Constant output: reading passes through");
+    }
+    zassert_float_equal(predictor.correction(), 0.0f, "Nothing in transit");
+}
+
+ZTEST(smith_predictor, cancels_delay_of_an_exact_model)
+{
+    SmithPredictor::Model model;
+    model.gain = -0.2f;
+    model.time_constant = 10.0f;
+    model.dead_time = 6.0f;
+    SmithPredictor predictor(model);
+
+    // Plant identical to the model, seen 6 samples late
+    float delayed[6] = {};
+    float plant = 0.0f;
+    float a = std::exp(-1.0f / model.time_constant);
+    float output = 0.0f;
+    float worst = 0.0f;
+    for (int k = 0; k < 60; k++) {
+        output = k >= 5 ? 50.0f : 0.0f;
+        plant = a * plant + (1.0f - a) * model.gain * output;
+        float measured = delayed[k % 6];
+        delayed[k % 6] = plant;
+        float feedback = predictor.update(30.0f + measured, output, 1.0f);
+        worst = std::max(worst, std::fabs(feedback - (30.0f + plant)));
+    }
+    zassert_true(worst < 1e-4f, "Feedback is the undelayed plant");
+}
+
+ZTEST(smith_predictor, interpolates_with_variable_period)
+{
+    SmithPredictor::Model model;
+    model.dead_time = 3.0f;
+    SmithPredictor predictor(model);
+    predictor.update(0.0f, 0.0f, 1.0f);
+
+    float t = 0.0f;
+    float worst = 0.0f;
+    for (int k = 0; k < 40; k++) {
+        float dt = k % 2 ? 1.5f : 0.5f;
+        t += dt;
+        predictor.update(0.0f, 60.0f, dt);
+        float expected = stepResponse(model, 60.0f, t) - stepResponse(model, 60.0f, t - model.dead_time);
+        worst = std::max(worst, std::fabs(predictor.correction() - expected));
+    }
+    zassert_true(worst < 0.05f, "Delayed model interpolated between uneven samples");
+    zassert_equal(predictor.overflows(), 0u, "Ring long enough");
+}
+
+ZTEST(smith_predictor, counts_dead_time_beyond_the_ring)
+{
+    SmithPredictor::Model model;
+    model.dead_time = 2.0f * SmithPredictor::kMaxDelaySamples;
+    SmithPredictor predictor(model);
+    for (size_t k = 0; k < 2 * SmithPredictor::kMaxDelaySamples; k++) {
+        predictor.update(25.0f, 50.0f, 1.0f);
+    }
+    zassert_true(predictor.overflows() > 0, "Too-long dead time reported");
+}
+
+ZTEST(smith_predictor, controller_regulates_on_the_prediction)
+{
+    reset_all_fakes();
+    StubSensor sensor;
+    VariableFan fan;
+    MockUartDriver uart;
+    UartLogger logger(uart);
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+    SmithPredictor predictor;
+    controller.setSmithPredictor(&predictor);
+
+    // Too hot: the fan turns on; the reading has not moved yet but the
+    // PID already sees the cooling on its way
+    sensor.value = 30.0f;
+    controller.regulate();
+    controller.regulate();
+    zassert_true(fan.getOutput() > 0.0f, "Fan on");
+    zassert_true(predictor.correction() < 0.0f, "Cooling in transit");
+    zassert_float_equal(controller.getStatistics().last_temp, 30.0f, "Statistics keep the raw reading");
+    zassert_true(std::fabs(controller.getPIDState().error - (25.0f - (30.0f + predictor.correction()))) < 1e-6f,
+                 "PID error from the compensated reading");
+}
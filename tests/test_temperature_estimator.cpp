@@ -0,0 +1,136 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "mocks/stub_sensor.hpp"
+#include "TemperatureEstimator.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "VariableFan.hpp"
+#include "LinearizedActuator.hpp"
+#include "UartLogger.hpp"
+#include <cmath>
+
+namespace {
+
+// Uniform noise in [-amplitude, amplitude], deterministic
+struct Noise {
+    uint32_t state = 1;
+    float next(float amplitude) {
+        state = state * 1664525u + 1013904223u;
+        return amplitude * (((state >> 8) & 0xFFFF) / 32767.5f - 1.0f);
+    }
+};
+
+} // namespace
+
+ZTEST(temperature_estimator, rejects_noise_on_steady_temperature)
+{
+    TemperatureEstimator estimator;
+    Noise noise;
+    double raw_sq = 0.0;
+    double est_sq = 0.0;
+    for (int i = 0; i < 600; i++) {
+        float reading = 30.0f + noise.next(0.3f);
+        estimator.update(reading, 1.0f, 0.0f);
+        if (i >= 100) {
+            raw_sq += (reading - 30.0f) * (reading - 30.0f);
+            est_sq += (estimator.temperature() - 30.0f) * (estimator.temperature() - 30.0f);
+        }
+    }
+    zassert_true(est_sq < raw_sq / 4.0, "Estimate error well under half the raw error");
+    zassert_true(std::fabs(estimator.rate()) < 0.02f, "Flat slope");
+    zassert_true(estimator.temperatureStd() < 0.2f, "Converged covariance");
+}
+
+ZTEST(temperature_estimator, tracks_a_ramp_without_lag)
+{
+    TemperatureEstimator estimator;
+    Noise noise;
+    double bias = 0.0;
+    for (int t = 0; t < 400; t++) {
+        float truth = 25.0f + 0.05f * t;
+        estimator.update(truth + noise.next(0.2f), 1.0f, 0.0f);
+        if (t >= 200) bias += estimator.temperature() - truth;
+    }
+    zassert_true(std::fabs(estimator.rate() - 0.05f) < 0.01f, "Slope of the ramp recovered");
+    zassert_true(std::fabs(bias / 200.0) < 0.05, "No steady lag behind the ramp");
+}
+
+ZTEST(temperature_estimator, predicts_the_fan_before_readings_move)
+{
+    TemperatureEstimator::Config config;
+    config.fan_conductance = 0.15f;
+    config.ambient = 20.0f;
+    TemperatureEstimator estimator(config);
+
+    // Equilibrium at 30 °C with the fan at 50%: heating balances cooling
+    for (int i = 0; i < 300; i++) {
+        estimator.update(30.0f, 1.0f, 50.0f);
+    }
+    zassert_true(std::fabs(estimator.rate()) < 0.01f, "Balanced");
+    float cooling_at_half = estimator.heatingRate();
+    zassert_true(std::fabs(cooling_at_half - 0.15f * 0.01f * QuadraticFanCurve::airflow(50.0f) * 10.0f) < 0.02f,
+                 "Heating rate equals the fan's cooling");
+
+    // Fan to 100%: the model expects cooling at once
+    estimator.predict(1.0f, 100.0f);
+    zassert_true(estimator.rate() < -0.8f, "Full airflow predicts a fast drop");
+    zassert_true(estimator.temperature() < 29.0f, "Temperature predicted down before any reading");
+}
+
+ZTEST(temperature_estimator, controller_uses_estimated_slope)
+{
+    reset_all_fakes();
+    StubSensor sensor;
+    VariableFan fan;
+    MockUartDriver uart;
+    UartLogger logger(uart);
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+    TemperatureEstimator estimator;
+    controller.setEstimator(&estimator);
+
+    sensor.value = 27.0f;
+    controller.regulate();
+    zassert_true(estimator.initialized(), "First reading initializes the filter");
+    for (int i = 0; i < 50; i++) controller.regulate();
+
+    // A single spike moves the estimate only part of the way
+    sensor.value = 33.0f;
+    controller.regulate();
+    zassert_float_equal(controller.getStatistics().last_temp, 33.0f, "Statistics keep the raw reading");
+    zassert_true(estimator.temperature() < 30.0f, "Spike attenuated");
+    zassert_true(std::fabs(controller.getPIDState().derivative + estimator.rate()) < 1e-6f,
+                 "PID derivative is the estimated slope");
+    zassert_true(std::fabs(controller.getPIDState().error - (25.0f - estimator.temperature())) < 1e-6f,
+                 "PID error from the estimate");
+}
+
+ZTEST(temperature_estimator, controller_feeds_delivered_airflow_of_linearized_fan)
+{
+    reset_all_fakes();
+    StubSensor sensor;
+    VariableFan fan;
+    LinearizedActuator<VariableFan::Curve> actuator(fan);
+    MockUartDriver uart;
+    UartLogger logger(uart);
+    PIDController::Config config;
+    config.kp = 10.0f;
+    config.ki = 0.0f;
+    config.kd = 0.0f;
+    config.setpoint = 25.0f;
+    AdvancedTemperatureController controller(sensor, actuator, logger, config);
+    controller.setDetailedTrace(false);
+    TemperatureEstimator estimator;
+    controller.setEstimator(&estimator);
+
+    // Steady at 30 °C: the estimated heating balances the fan's cooling
+    sensor.value = 30.0f;
+    for (int i = 0; i < 300; i++) controller.regulate();
+    const TemperatureEstimator::Config& model = estimator.getConfig();
+    float cooling = model.fan_conductance * 0.01f * fan.getAirflow() * (30.0f - model.ambient);
+    float cooling_curved_twice = model.fan_conductance * 0.01f * VariableFan::Curve::airflow(actuator.getOutput()) *
+                                 (30.0f - model.ambient);
+    zassert_true(actuator.getOutput() > 10.0f && actuator.getOutput() < 90.0f, "Fan part way");
+    zassert_true(std::fabs(actuator.getAirflow() - actuator.getOutput()) < 1.0f, "Linearized airflow follows the request");
+    zassert_true(std::fabs(estimator.heatingRate() - cooling) < 0.002f, "Model uses the airflow the fan delivers");
+    zassert_true(std::fabs(cooling_curved_twice - cooling) > 0.01f, "Applying the curve again would be far off");
+}
@@ -0,0 +1,101 @@
+#include "ztest_framework.hpp"
+#include "TraceRecorder.hpp"
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+// Records into a fresh thread's buffer, so each test sees its own tid
+template <typename Fn>
+void onNewThread(Fn fn) {
+    std::thread thread(fn);
+    thread.join();
+}
+
+std::string writeTrace() {
+    char path[] = "/tmp/trace_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) return "";
+    close(fd);
+    std::string json;
+    if (TraceRecorder::writeChromeJson(path)) {
+        FILE* in = fopen(path, "r");
+        char chunk[4096];
+        size_t n;
+        while (in && (n = fread(chunk, 1, sizeof(chunk), in)) > 0) json.append(chunk, n);
+        if (in) fclose(in);
+    }
+    remove(path);
+    return json;
+}
+
+size_t count(const std::string& text, const std::string& needle) {
+    size_t n = 0;
+    for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) n++;
+    return n;
+}
+
+} // namespace
+
+ZTEST(trace_recorder, writes_complete_events_as_chrome_json)
+{
+    // The test binary writes its own trace files; no trace.json at exit
+    TraceRecorder::setExitFlush(false);
+    uint64_t t0 = TraceRecorder::nowNs();
+    onNewThread([t0]() {
+        TraceRecorder::record("trace_test_read", t0, t0 + 1500);
+        TraceRecorder::record("trace_test_read", t0 + 2000, t0 + 2250);
+    });
+    onNewThread([]() {
+        TraceScope scope("trace_test_write");
+        // Began before the recorder's time origin: negative, not wrapped
+        TraceRecorder::record("trace_test_early", 0, 1);
+    });
+
+    std::string json = writeTrace();
+    zassert_true(json.rfind("{\"traceEvents\":[\n", 0) == 0, "Chrome trace object");
+    zassert_true(json.find("\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":") != std::string::npos,
+                 "Closed with the dropped-event count");
+    zassert_equal(json.back(), '\n', "Complete file");
+    zassert_equal(count(json, "\"name\":\"trace_test_read\",\"ph\":\"X\""), 2u, "Both recorded events");
+    zassert_equal(count(json, "\"name\":\"trace_test_write\",\"ph\":\"X\""), 1u, "Scope recorded on exit");
+    zassert_true(json.find("\"dur\":1.500,") != std::string::npos, "Duration in microseconds");
+    zassert_true(json.find("\"dur\":0.250,") != std::string::npos, "Sub-microsecond duration kept");
+    size_t early = json.find("\"name\":\"trace_test_early\"");
+    zassert_true(early != std::string::npos && json.compare(json.find("\"ts\":", early), 6, "\"ts\":-") == 0,
+                 "Events before the origin get negative timestamps");
+
+    // One tid per recording thread
+    size_t read = json.find("trace_test_read");
+    size_t write = json.find("trace_test_write");
+    std::string read_tid = json.substr(json.find("\"tid\":", read), json.find('}', read) - json.find("\"tid\":", read));
+    std::string write_tid = json.substr(json.find("\"tid\":", write), json.find('}', write) - json.find("\"tid\":", write));
+    zassert_true(read_tid != write_tid, "Threads get their own tid");
+}
+
+ZTEST(trace_recorder, full_buffer_counts_dropped_events)
+{
+    TraceRecorder::setExitFlush(false);
+    onNewThread([]() {
+        for (uint32_t i = 0; i < TraceRecorder::kEventsPerThread + 10; i++) {
+            TraceRecorder::record("trace_test_fill", i, i + 1);
+        }
+    });
+    std::string json = writeTrace();
+    zassert_equal(count(json, "\"name\":\"trace_test_fill\""), static_cast<size_t>(TraceRecorder::kEventsPerThread),
+                  "Buffer keeps the first events");
+    zassert_true(json.find("\"dropped_events\":10}") != std::string::npos, "Overflow reported");
+}
+
+ZTEST(trace_recorder, interrupt_only_sets_the_stop_flag)
+{
+    TraceRecorder::setExitFlush(false);
+    onNewThread([]() { TraceRecorder::record("trace_test_hook", 0, 1); });
+    zassert_false(TraceRecorder::stopRequested(), "No stop before Ctrl+C");
+    std::raise(SIGINT);
+    zassert_true(TraceRecorder::stopRequested(), "Ctrl+C sets the flag and returns");
+}
@@ -0,0 +1,55 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "VariableFan.hpp"
+
+ZTEST(variable_fan, test_output_is_clamped) {
+    reset_all_fakes();
+    VariableFan fan;
+
+    fan.setOutput(150.0f);
+    zassert_equal(fan.getOutput(), 100.0f, "Output should clamp to 100%");
+    fan.setOutput(-10.0f);
+    zassert_equal(fan.getOutput(), 0.0f, "Output should clamp to 0%");
+    zassert_false(fan.isActive(), "Fan should be inactive at 0%");
+}
+
+ZTEST(variable_fan, test_duty_quantized_to_timer_resolution) {
+    reset_all_fakes();
+    MockPwmDriver mock_pwm(200); // 0.5% per count
+    VariableFan fan(mock_pwm);
+
+    fan.setOutput(50.0f);
+    zassert_equal(pwm_set_pulse_cycles_fake.arg0_val, 100u, "50% of 200 counts should be 100");
+    fan.setOutput(33.3f);
+    zassert_equal(pwm_set_pulse_cycles_fake.arg0_val, 67u, "33.3% should round to 67 counts");
+    fan.setOutput(100.0f);
+    zassert_equal(pwm_set_pulse_cycles_fake.arg0_val, 200u, "100% should be full period");
+    zassert_equal(fan.getPulseCycles(), 200u, "Fan should report last written pulse");
+}
+
+ZTEST(variable_fan, test_unchanged_duty_suppresses_write) {
+    reset_all_fakes();
+    MockPwmDriver mock_pwm(100); // 1% per count
+    VariableFan fan(mock_pwm);
+
+    fan.setOutput(40.0f);
+    fan.setOutput(40.2f); // quantizes to the same 40 counts
+    fan.setOutput(40.0f);
+    fan.setOutput(41.0f);
+
+    zassert_equal(pwm_set_pulse_cycles_fake.call_count, 2, "Only changed duty should reach the driver");
+    zassert_equal(fan.getPwmStats().writes_issued, 2u, "Two writes should be counted");
+    zassert_equal(fan.getPwmStats().writes_suppressed, 2u, "Two writes should be suppressed");
+    zassert_equal(fan.getOutput(), 41.0f, "Requested output should still be tracked");
+}
+
+ZTEST(variable_fan, test_first_write_always_issued) {
+    reset_all_fakes();
+    MockPwmDriver mock_pwm;
+    VariableFan fan(mock_pwm);
+
+    // The register state after reset is unknown, so 0% must still be written
+    fan.setOutput(0.0f);
+    zassert_equal(pwm_set_pulse_cycles_fake.call_count, 1, "First write should reach the driver");
+    zassert_equal(pwm_set_pulse_cycles_fake.arg0_val, 0u, "Pulse should be zero");
+}
@@ -0,0 +1,246 @@
+#include "ztest_framework.hpp"
+#include "mocks/fff_mocks.hpp"
+#include "mocks/stub_sensor.hpp"
+#include "WarmStartStore.hpp"
+#include "AdcSensor.hpp"
+#include "VariableFan.hpp"
+#include "UartLogger.hpp"
+#include "AdvancedTemperatureController.hpp"
+#include "PlantIdentifier.hpp"
+#include <cmath>
+
+#define UartDriver MockUartDriver
+
+namespace {
+
+PIDController::State stateWithIntegral(float integral) {
+    PIDController::State state;
+    state.integral = integral;
+    state.output = 42.0f;
+    return state;
+}
+
+} // namespace
+
+ZTEST(warm_start, record_round_trips_and_rejects_corruption)
+{
+    MockSettingsDriver settings;
+    WarmStartStore store(settings);
+    PIDController::Config config;
+    config.setpoint = 31.5f;
+    config.kp = 7.0f;
+    zassert_true(store.flush(config, stateWithIntegral(-12.5f)), "Saved");
+    zassert_equal(settings.record("tempctrl/pid").size(), sizeof(WarmStartStore::Record), "44-byte record");
+
+    PIDController::Config loaded;
+    float integral = 0.0f;
+    float output = 0.0f;
+    WarmStartStore reader(settings);
+    zassert_true(reader.load(loaded, integral, output), "Valid record loads");
+    zassert_float_equal(loaded.setpoint, 31.5f, "Setpoint restored");
+    zassert_float_equal(loaded.kp, 7.0f, "Gains restored");
+    zassert_float_equal(integral, -12.5f, "Integral restored");
+    zassert_float_equal(output, 42.0f, "Output restored");
+
+    settings.corrupt("tempctrl/pid", 10);
+    zassert_false(reader.load(loaded, integral, output), "CRC mismatch rejected");
+    settings.corrupt("tempctrl/pid", 10);
+    zassert_true(reader.load(loaded, integral, output), "Restored bytes load again");
+
+    // A future layout with a valid CRC is still refused
+    WarmStartStore::Record record = WarmStartStore::makeRecord(config, stateWithIntegral(0.0f));
+    record.version = WarmStartStore::kVersion + 1;
+    record.crc = crc::crc32(&record, offsetof(WarmStartStore::Record, crc));
+    settings.save("tempctrl/pid", &record, sizeof(record));
+    zassert_false(reader.load(loaded, integral, output), "Other version rejected");
+
+    settings.record("tempctrl/pid").resize(20);
+    zassert_false(reader.load(loaded, integral, output), "Truncated record rejected");
+}
+
+ZTEST(warm_start, writes_are_coalesced)
+{
+    MockSettingsDriver settings;
+    WarmStartStore store(settings);
+    PIDController::Config config;
+
+    zassert_true(store.update(config, stateWithIntegral(0.0f), 1.0f), "First state saved at once");
+    unsigned int writes = settings.getWriteCount();
+
+    // Small drift: nothing until max_interval
+    for (int t = 1; t < 3600; t++) {
+        store.update(config, stateWithIntegral(t * 0.001f), 1.0f);
+    }
+    zassert_equal(settings.getWriteCount(), writes, "Sub-threshold drift deferred");
+    store.update(config, stateWithIntegral(3.6f), 1.0f);
+    zassert_equal(settings.getWriteCount(), writes + 1, "Written once max_interval elapsed");
+
+    // Large drift: at most one write per min_interval
+    for (int t = 0; t < 600; t++) {
+        store.update(config, stateWithIntegral(3.6f + t), 1.0f);
+    }
+    zassert_equal(settings.getWriteCount(), writes + 3, "Two min_interval saves in 600 s");
+
+    // Unchanged state never writes
+    unsigned int before = settings.getWriteCount();
+    PIDController::State steady = stateWithIntegral(100.0f);
+    store.flush(config, steady);
+    for (int t = 0; t < 10000; t++) {
+        store.update(config, steady, 1.0f);
+    }
+    zassert_equal(settings.getWriteCount(), before + 1, "Identical records not rewritten");
+}
+
+ZTEST(warm_start, setpoint_burst_costs_one_write)
+{
+    MockSettingsDriver settings;
+    WarmStartStore store(settings);
+    PIDController::Config config;
+    PIDController::State state = stateWithIntegral(1.0f);
+    store.flush(config, state);
+    unsigned int writes = settings.getWriteCount();
+
+    for (int step = 0; step < 5; step++) {
+        config.setpoint += 0.5f;
+        store.update(config, state, 1.0f);
+        store.update(config, state, 1.0f);
+    }
+    zassert_equal(settings.getWriteCount(), writes, "Still adjusting: nothing written");
+    for (int t = 0; t < 10; t++) {
+        store.update(config, state, 1.0f);
+    }
+    zassert_equal(settings.getWriteCount(), writes + 1, "One write after config_delay of quiet");
+}
+
+ZTEST(warm_start, gain_changes_wait_for_min_interval_and_threshold)
+{
+    MockSettingsDriver settings;
+    WarmStartStore store(settings);
+    PIDController::Config config;
+    PIDController::State state = stateWithIntegral(1.0f);
+    store.flush(config, state);
+    unsigned int writes = settings.getWriteCount();
+
+    // 5 % on kp: below gain_threshold, waits for max_interval
+    config.kp *= 1.05f;
+    for (int t = 0; t < 600; t++) store.update(config, state, 1.0f);
+    zassert_equal(settings.getWriteCount(), writes, "Small gain change deferred");
+
+    // 30 %: written, but not before min_interval since the last write
+    config.kp *= 1.3f;
+    store.flush(config, state);
+    writes = settings.getWriteCount();
+    config.ki *= 1.3f;
+    for (int t = 1; t < 300; t++) store.update(config, state, 1.0f);
+    zassert_equal(settings.getWriteCount(), writes, "Not before min_interval");
+    store.update(config, state, 1.0f);
+    zassert_equal(settings.getWriteCount(), writes + 1, "Large gain change saved at min_interval");
+}
+
+ZTEST(warm_start, adaptive_gains_do_not_wear_flash)
+{
+    reset_all_fakes();
+    StubSensor sensor;
+    MockPwmDriver pwm;
+    VariableFan fan(pwm);
+    MockUartDriver uart;
+    UartLogger logger(uart);
+    PIDController::Config config;
+    config.kp = 4.0f;
+    config.ki = 0.2f;
+    config.kd = 0.0f;
+    config.setpoint = 28.0f;
+    config.integral_max = config.output_max / config.ki;
+    AdvancedTemperatureController controller(sensor, fan, logger, config);
+    controller.setDetailedTrace(false);
+    PlantIdentifier identifier;
+    controller.setIdentifier(&identifier, 30);
+    MockSettingsDriver settings;
+    WarmStartStore store(settings);
+    controller.enableWarmStart(store);
+
+    // First-order zone, tau 20 s, 40 °C with the fan off; setpoint changes every 10 min
+    const float a = std::exp(-1.0f / 20.0f);
+    float temp = 30.0f;
+    float output = 0.0f;
+    uint32_t lcg = 1;
+    const int kSeconds = 3600;
+    for (int k = 0; k < kSeconds; k++) {
+        if (k % 600 == 0) controller.setSetpoint(k % 1200 ? 30.0f : 28.0f);
+        lcg = lcg * 1664525u + 1013904223u;
+        sensor.value = temp + 0.02f * (((lcg >> 8) & 0xFFFF) / 32767.5f - 1.0f);
+        controller.regulate(1.0f);
+        temp = a * temp + (1.0f - a) * (40.0f - 0.2f * output);
+        output = fan.getOutput();
+    }
+
+    zassert_true(controller.getStatistics().gain_adaptations > 20, "Identifier kept adapting the gains");
+    // Seed, one per setpoint change, and gains/integral at most every min_interval
+    unsigned int bound = 1 + kSeconds / 600 + kSeconds / 300;
+    zassert_true(settings.getWriteCount() <= bound, "Writes bounded by the policy, not by adaptations");
+}
+
+ZTEST(warm_start, failed_write_backs_off)
+{
+    MockSettingsDriver settings;
+    settings.setFailing(true);
+    WarmStartStore store(settings);
+    PIDController::Config config;
+    for (int t = 0; t < 25; t++) {
+        store.update(config, stateWithIntegral(1.0f), 1.0f);
+    }
+    zassert_equal(store.getStats().failed_writes, 3u, "Retried every config_delay, not every cycle");
+}
+
+ZTEST(warm_start, controller_resumes_saved_integral)
+{
+    reset_all_fakes();
+    MockAdcDriver adc;
+    MockPwmDriver pwm;
+    MockUartDriver uart;
+    AdcSensor sensor(adc);
+    VariableFan fan(pwm);
+    UartLogger logger(uart);
+    MockSettingsDriver settings;
+
+    PIDController::Config saved;
+    saved.setpoint = 28.0f;
+    saved.ki = 0.5f;
+    WarmStartStore writer(settings);
+    writer.flush(saved, stateWithIntegral(-40.0f));
+
+    WarmStartStore store(settings);
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+    zassert_true(controller.enableWarmStart(store), "Record restored");
+    zassert_float_equal(controller.getSetpoint(), 28.0f, "Saved setpoint active");
+    zassert_float_equal(controller.getPIDState().integral, -40.0f, "Saved integral active");
+
+    // 28 °C exactly at the setpoint: output is the integral term alone
+    adc_read_raw_fake.return_val = 347;
+    controller.regulate();
+    zassert_true(controller.getPIDState().output > 15.0f, "First cycle already drives the fan");
+    zassert_true(controller.getPIDState().d_term == 0.0f, "No derivative kick on the first cycle");
+}
+
+ZTEST(warm_start, controller_cold_starts_without_record)
+{
+    reset_all_fakes();
+    MockAdcDriver adc;
+    MockPwmDriver pwm;
+    MockUartDriver uart;
+    AdcSensor sensor(adc);
+    VariableFan fan(pwm);
+    UartLogger logger(uart);
+    MockSettingsDriver settings;
+
+    WarmStartStore store(settings);
+    AdvancedTemperatureController controller(sensor, fan, logger);
+    controller.setDetailedTrace(false);
+    zassert_false(controller.enableWarmStart(store), "Nothing to restore");
+    zassert_float_equal(controller.getPIDState().integral, 0.0f, "Cold integral");
+
+    adc_read_raw_fake.return_val = 372;
+    controller.regulate();
+    zassert_equal(settings.getWriteCount(), 1u, "First cycle seeds the store");
+}